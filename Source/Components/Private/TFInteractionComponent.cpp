@@ -2,6 +2,9 @@
 
 #include "TFInteractionComponent.h"
 #include "TFTypes.h"
+#include "TFStats.h"
+#include "TFViewQuerySubsystem.h"
+#include "TFInteractableGridSubsystem.h"
 
 #include "GameFramework/Character.h"
 #include "TFInteractableInterface.h"
@@ -48,6 +51,7 @@ void UTFInteractionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		World->GetTimerManager().ClearTimer(DetectionTimerHandle);
 	}
 
+	PendingTraceHandle = FTraceHandle();
 	ClearFocus();
 
 	Super::EndPlay(EndPlayReason);
@@ -55,6 +59,14 @@ void UTFInteractionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 void UTFInteractionComponent::PerformInteractionCheck()
 {
+	RunInteractionCheck(bUseAsyncTrace);
+}
+
+void UTFInteractionComponent::RunInteractionCheck(bool bAllowAsync)
+{
+	TF_SCOPE_CYCLE_COUNTER(InteractionCheck);
+	INC_DWORD_STAT(STAT_TFInteractionChecks);
+
 	if (!OwnerCharacter)
 	{
 		return;
@@ -69,10 +81,121 @@ void UTFInteractionComponent::PerformInteractionCheck()
 		OnInteractionLost.Broadcast();
 	}
 
+	// Nothing registered within reach: skip the scene query entirely
+	if (!HasInteractableInRange())
+	{
+		PendingTraceHandle = FTraceHandle();
+		ClearFocus();
+		return;
+	}
+
+	FHitResult HitResult;
+	bool bHit = false;
+
+	// Player line traces share the per-frame view query with the crosshair
+	UTFViewQuerySubsystem* ViewQuery = InteractionRadius <= 0.0f
+		? UTFViewQuerySubsystem::Get(Cast<APlayerController>(OwnerCharacter->GetController()))
+		: nullptr;
+
+	if (ViewQuery)
+	{
+		const FTFViewQueryResult* ViewResult = ViewQuery->QueryView(InteractionTraceChannel, bTraceComplex, InteractionDistance);
+		bHit = ViewResult && ViewResult->HasHitWithin(InteractionDistance);
+		if (bHit)
+		{
+			HitResult = ViewResult->Hit;
+		}
+	}
+	else if (bAllowAsync)
+	{
+		// Result is applied in OnAsyncTraceComplete
+		RequestAsyncTrace();
+		return;
+	}
+	else
+	{
+		// A synchronous result supersedes any trace still in flight
+		PendingTraceHandle = FTraceHandle();
+		bHit = TraceForInteractable(HitResult);
+	}
+
+	if (bHit)
+	{
+		ProcessHitResult(HitResult);
+	}
+	else
+	{
+		ClearFocus();
+	}
+}
+
+bool UTFInteractionComponent::TraceForInteractable(FHitResult& OutHitResult) const
+{
+	UWorld* World = GetWorld();
+	FVector TraceStart, TraceEnd;
+	if (!World || !GetTracePoints(TraceStart, TraceEnd))
+	{
+		return false;
+	}
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TFInteractionTrace), bTraceComplex);
+	QueryParams.AddIgnoredActor(OwnerCharacter);
+
+	if (InteractionRadius > 0.0f)
+	{
+		return World->SweepSingleByChannel(
+			OutHitResult,
+			TraceStart,
+			TraceEnd,
+			FQuat::Identity,
+			InteractionTraceChannel,
+			FCollisionShape::MakeSphere(InteractionRadius),
+			QueryParams
+		);
+	}
+
+	return World->LineTraceSingleByChannel(
+		OutHitResult,
+		TraceStart,
+		TraceEnd,
+		InteractionTraceChannel,
+		QueryParams
+	);
+}
+
+bool UTFInteractionComponent::HasInteractableInRange() const
+{
+	const UTFInteractableGridSubsystem* Grid = UTFInteractableGridSubsystem::Get(this);
+	if (!Grid)
+	{
+		return true;
+	}
+
+	FVector TraceStart, TraceEnd;
+	if (!GetTracePoints(TraceStart, TraceEnd))
+	{
+		return false;
+	}
+
+	return Grid->HasInteractableNear(TraceStart, InteractionDistance + InteractionRadius);
+}
+
+void UTFInteractionComponent::RequestAsyncTrace()
+{
 	UWorld* World = GetWorld();
 	if (!World)
 	{
-		ClearFocus();
+		return;
+	}
+
+	// Keep at most one trace in flight
+	if (PendingTraceHandle.IsValid() && !World->IsTraceHandleValid(PendingTraceHandle, false))
+	{
+		PendingTraceHandle = FTraceHandle();
+	}
+
+	if (PendingTraceHandle.IsValid())
+	{
 		return;
 	}
 
@@ -83,38 +206,69 @@ void UTFInteractionComponent::PerformInteractionCheck()
 		return;
 	}
 
-	FHitResult HitResult;
-	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TFInteractionTrace), bTraceComplex);
-	QueryParams.AddIgnoredActor(OwnerCharacter);
+	if (!AsyncTraceDelegate.IsBound())
+	{
+		AsyncTraceDelegate.BindUObject(this, &UTFInteractionComponent::OnAsyncTraceComplete);
+	}
 
-	bool bHit = false;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TFInteractionAsyncTrace), bTraceComplex);
+	QueryParams.AddIgnoredActor(OwnerCharacter);
 
 	if (InteractionRadius > 0.0f)
 	{
-		bHit = World->SweepSingleByChannel(
-			HitResult,
+		PendingTraceHandle = World->AsyncSweepByChannel(
+			EAsyncTraceType::Single,
 			TraceStart,
 			TraceEnd,
 			FQuat::Identity,
 			InteractionTraceChannel,
 			FCollisionShape::MakeSphere(InteractionRadius),
-			QueryParams
+			QueryParams,
+			FCollisionResponseParams::DefaultResponseParam,
+			&AsyncTraceDelegate
 		);
 	}
 	else
 	{
-		bHit = World->LineTraceSingleByChannel(
-			HitResult,
+		PendingTraceHandle = World->AsyncLineTraceByChannel(
+			EAsyncTraceType::Single,
 			TraceStart,
 			TraceEnd,
 			InteractionTraceChannel,
-			QueryParams
+			QueryParams,
+			FCollisionResponseParams::DefaultResponseParam,
+			&AsyncTraceDelegate
 		);
 	}
+}
 
-	if (bHit)
+void UTFInteractionComponent::OnAsyncTraceComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	// Superseded by a synchronous check or a disable since it was issued
+	if (TraceHandle != PendingTraceHandle)
 	{
-		ProcessHitResult(HitResult);
+		return;
+	}
+
+	PendingTraceHandle = FTraceHandle();
+
+	if (!OwnerCharacter)
+	{
+		return;
+	}
+
+	if (CurrentInteractable.IsStale())
+	{
+		CurrentInteractable = nullptr;
+		PreviousInteractable = nullptr;
+		CurrentInteractionData = FInteractionData();
+		OnInteractionLost.Broadcast();
+	}
+
+	const FHitResult* BlockingHit = TraceDatum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+	if (BlockingHit)
+	{
+		ProcessHitResult(*BlockingHit);
 	}
 	else
 	{
@@ -256,7 +410,7 @@ void UTFInteractionComponent::Interact()
 	// avoiding misses caused by the timer-based detection lag
 	if (!CurrentInteractable.IsValid())
 	{
-		PerformInteractionCheck();
+		RunInteractionCheck(false);
 	}
 
 	if (!CurrentInteractable.IsValid())
@@ -319,7 +473,7 @@ bool UTFInteractionComponent::InteractWithActor(AActor* Actor)
 void UTFInteractionComponent::ForceInteractionRefresh()
 {
 	ClearFocus();
-	PerformInteractionCheck();
+	RunInteractionCheck(false);
 }
 
 void UTFInteractionComponent::SetInteractionEnabled(bool bEnabled)
@@ -339,6 +493,7 @@ void UTFInteractionComponent::SetInteractionEnabled(bool bEnabled)
 		else
 		{
 			World->GetTimerManager().ClearTimer(DetectionTimerHandle);
+			PendingTraceHandle = FTraceHandle();
 			ClearFocus();
 		}
 	}
@@ -1,9 +1,9 @@
 // Copyright TF Project. All Rights Reserved.
 
 #include "TFStaminaComponent.h"
+#include "TFStats.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
-#include "Engine/TimerHandle.h"
 
 UTFStaminaComponent::UTFStaminaComponent()
 {
@@ -24,16 +24,13 @@ void UTFStaminaComponent::BeginPlay()
 	CurrentStamina = MaxStamina;
 
 	// Broadcast initial values
-	OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
+	BroadcastStaminaChanged(true);
 }
 
 void UTFStaminaComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	// Clear drain timer
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(DrainTimerHandle);
-	}
+	bIsDraining = false;
+	ActiveDrainRate = 0.0f;
 
 	Super::EndPlay(EndPlayReason);
 }
@@ -42,6 +39,14 @@ void UTFStaminaComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	UpdateStamina(DeltaTime);
+}
+
+void UTFStaminaComponent::UpdateStamina(float DeltaTime)
+{
+	TF_SCOPE_CYCLE_COUNTER(StaminaUpdate);
+	INC_DWORD_STAT(STAT_TFStaminaUpdates);
+
 	// Update regeneration delay timer
 	if (RegenDelayTimer > 0.0f)
 	{
@@ -53,8 +58,12 @@ void UTFStaminaComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
 		bIsRegenerating = true;
 	}
 
-	// Regenerate stamina if allowed
-	if (bIsRegenerating && !bIsDraining && CurrentStamina < MaxStamina)
+	// Drain and regen are exclusive: regen waits for the drain to stop and the delay to run out
+	if (bIsDraining)
+	{
+		DrainStamina(DeltaTime);
+	}
+	else if (bIsRegenerating && CurrentStamina < MaxStamina)
 	{
 		RegenerateStamina(DeltaTime);
 	}
@@ -62,6 +71,8 @@ void UTFStaminaComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
 	// Update exhaustion state
 	UpdateExhaustionState();
 
+	BroadcastStaminaChanged(false);
+
 	// Disable tick if stamina is full and not draining
 	if (CurrentStamina >= MaxStamina && !bIsDraining && !bIsExhausted)
 	{
@@ -69,6 +80,35 @@ void UTFStaminaComponent::TickComponent(float DeltaTime, ELevelTick TickType, FA
 	}
 }
 
+void UTFStaminaComponent::DrainStamina(float DeltaTime)
+{
+	// Apply drain rate multiplier
+	const float EffectiveDrain = GetEffectiveDrainRate(ActiveDrainRate) * DeltaTime;
+
+	const float OldStamina = CurrentStamina;
+	CurrentStamina = FMath::Clamp(CurrentStamina - EffectiveDrain, 0.0f, MaxStamina);
+
+	// Check if depleted
+	if (CurrentStamina <= 0.0f && OldStamina > 0.0f)
+	{
+		ResetRegenDelay(true);
+		StopStaminaDrain();
+	}
+}
+
+void UTFStaminaComponent::BroadcastStaminaChanged(bool bForce)
+{
+	// Always report reaching empty or full so listeners see the bounds exactly
+	const bool bAtBound = CurrentStamina <= 0.0f || CurrentStamina >= MaxStamina;
+	const float Delta = FMath::Abs(CurrentStamina - LastBroadcastStamina);
+
+	if (bForce || Delta >= BroadcastDeltaThreshold || (bAtBound && Delta > 0.0f))
+	{
+		LastBroadcastStamina = CurrentStamina;
+		OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
+	}
+}
+
 void UTFStaminaComponent::RegenerateStamina(float DeltaTime)
 {
 	if (CurrentStamina >= MaxStamina)
@@ -85,15 +125,8 @@ void UTFStaminaComponent::RegenerateStamina(float DeltaTime)
 		RegenRate *= ExhaustedRegenMultiplier;
 	}
 
-	// Regenerate stamina
-	float OldStamina = CurrentStamina;
+	// Regenerate stamina; the update step broadcasts once the change is large enough
 	CurrentStamina = FMath::Clamp(CurrentStamina + (RegenRate * DeltaTime), 0.0f, MaxStamina);
-
-	// Broadcast change if stamina actually changed
-	if (!FMath::IsNearlyEqual(OldStamina, CurrentStamina, 0.01f))
-	{
-		OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
-	}
 }
 
 void UTFStaminaComponent::UpdateExhaustionState()
@@ -162,7 +195,7 @@ bool UTFStaminaComponent::ConsumeStamina(float Amount, EStaminaDrainReason Reaso
 	SetComponentTickEnabled(true);
 
 	// Broadcast change
-	OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
+	BroadcastStaminaChanged(true);
 
 	return true;
 }
@@ -175,44 +208,10 @@ void UTFStaminaComponent::StartStaminaDrain(float DrainRate)
 	}
 
 	bIsDraining = true;
+	ActiveDrainRate = DrainRate;
 
-	// Enable tick for exhaustion state updates
+	// Drain runs in the same tick as regeneration and exhaustion
 	SetComponentTickEnabled(true);
-
-	constexpr float TimerTickRate = 0.1f;
-
-	FTimerDelegate TimerDel;
-	TimerDel.BindLambda([this, DrainRate, TimerTickRate]()
-		{
-			if (bIsDraining)
-			{
-				// Apply drain rate multiplier
-				float EffectiveDrain = DrainRate * DrainRateMultiplier * TimerTickRate;
-
-				float OldStamina = CurrentStamina;
-				CurrentStamina = FMath::Clamp(CurrentStamina - EffectiveDrain, 0.0f, MaxStamina);
-
-				// Check if depleted
-				if (CurrentStamina <= 0.0f && OldStamina > 0.0f)
-				{
-					ResetRegenDelay(true);
-					StopStaminaDrain();
-				}
-
-				OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
-			}
-		});
-
-	UWorld* World = GetWorld();
-	if (World)
-	{
-		World->GetTimerManager().SetTimer(
-			DrainTimerHandle,
-			TimerDel,
-			TimerTickRate,
-			true
-		);
-	}
 }
 
 void UTFStaminaComponent::StopStaminaDrain()
@@ -223,15 +222,10 @@ void UTFStaminaComponent::StopStaminaDrain()
 	}
 
 	bIsDraining = false;
-
-	// Clear the drain timer to stop the looping callback
-	if (GetWorld())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(DrainTimerHandle);
-	}
+	ActiveDrainRate = 0.0f;
 
 	// Reset regeneration delay after usage, but only if stamina wasn't depleted
-	// (depletion already set the longer delay in StartStaminaDrain)
+	// (depletion already set the longer delay in DrainStamina)
 	if (CurrentStamina > 0.0f)
 	{
 		ResetRegenDelay(false);
@@ -246,7 +240,7 @@ void UTFStaminaComponent::RestoreStamina(float Amount)
 	// Broadcast change if stamina actually changed
 	if (!FMath::IsNearlyEqual(OldStamina, CurrentStamina, 0.01f))
 	{
-		OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
+		BroadcastStaminaChanged(true);
 	}
 
 	EnsureTickEnabledIfNeeded();
@@ -255,7 +249,7 @@ void UTFStaminaComponent::RestoreStamina(float Amount)
 void UTFStaminaComponent::SetStamina(float NewStamina)
 {
 	CurrentStamina = FMath::Clamp(NewStamina, 0.0f, MaxStamina);
-	OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
+	BroadcastStaminaChanged(true);
 
 	EnsureTickEnabledIfNeeded();
 }
@@ -265,7 +259,7 @@ void UTFStaminaComponent::FullyRestoreStamina()
 	CurrentStamina = MaxStamina;
 	bIsExhausted = false;
 	RegenDelayTimer = 0.0f;
-	OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
+	BroadcastStaminaChanged(true);
 	OnStaminaRecovered.Broadcast();
 }
 
@@ -327,7 +321,7 @@ void UTFStaminaComponent::SetMaxStamina(float NewMax)
 	MaxStamina = NewMax;
 	CurrentStamina = MaxStamina * Percentage;
 
-	OnStaminaChanged.Broadcast(CurrentStamina, MaxStamina);
+	BroadcastStaminaChanged(true);
 
 	EnsureTickEnabledIfNeeded();
 }
@@ -1,335 +1,471 @@
 // Copyright TF Project. All Rights Reserved.
 
 #include "TFStatsComponent.h"
-#include "TFTypes.h"
+#include "TFStatsSubsystem.h"
+#include "Engine/World.h"
 #include "TimerManager.h"
 
+#if WITH_EDITORONLY_DATA
+namespace
+{
+	/** Moves one saved per-stat field into its definition and clears it */
+	void FoldDeprecatedValue(float& DeprecatedValue, float& DefinitionValue)
+	{
+		if (DeprecatedValue >= 0.0f)
+		{
+			DefinitionValue = DeprecatedValue;
+			DeprecatedValue = -1.0f;
+		}
+	}
+
+	/** Folds the pre-StatDefinitions fields of one stat into its definition, added if missing */
+	void FoldDeprecatedStat(TArray<FTFStatDefinition>& Definitions, FName StatName, float& MaxValue, float& DecayAmount, float& DecayInterval, float& CriticalThreshold)
+	{
+		// Only values overriding the old defaults were saved; nothing to fold leaves the array as authored
+		if (MaxValue < 0.0f && DecayAmount < 0.0f && DecayInterval < 0.0f && CriticalThreshold < 0.0f)
+		{
+			return;
+		}
+
+		FTFStatDefinition* Definition = Definitions.FindByPredicate([StatName](const FTFStatDefinition& Entry) { return Entry.StatName == StatName; });
+		if (!Definition)
+		{
+			Definition = &Definitions.AddDefaulted_GetRef();
+			Definition->StatName = StatName;
+		}
+
+		FoldDeprecatedValue(MaxValue, Definition->MaxValue);
+		FoldDeprecatedValue(DecayAmount, Definition->DecayAmount);
+		FoldDeprecatedValue(DecayInterval, Definition->DecayInterval);
+		FoldDeprecatedValue(CriticalThreshold, Definition->CriticalThreshold);
+	}
+}
+#endif // WITH_EDITORONLY_DATA
+
 UTFStatsComponent::UTFStatsComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
 
-	CurrentHunger = MaxHunger;
-	CurrentThirst = MaxThirst;
+	FTFStatDefinition& Hunger = StatDefinitions.AddDefaulted_GetRef();
+	Hunger.StatName = TFStatNames::Hunger;
+	Hunger.DecayAmount = 1.0f;
+	Hunger.DecayInterval = 5.0f;
+
+	FTFStatDefinition& Thirst = StatDefinitions.AddDefaulted_GetRef();
+	Thirst.StatName = TFStatNames::Thirst;
+	Thirst.DecayAmount = 1.5f;
+	Thirst.DecayInterval = 4.0f;
 }
 
 void UTFStatsComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Initialize stats to max
-	CurrentHunger = MaxHunger;
-	CurrentThirst = MaxThirst;
+	RegisterStatRows();
 
-	OnHungerChanged.Broadcast(CurrentHunger, MaxHunger);
-	OnThirstChanged.Broadcast(CurrentThirst, MaxThirst);
-
-	UpdateHungerCriticalState();
-	UpdateThirstCriticalState();
-
-	// Start decay timers
-	StartDecayTimers();
+	for (int32 StatIndex = 0; StatIndex < ActiveDefinitions.Num(); ++StatIndex)
+	{
+		BroadcastStatChanged(StatIndex);
+		UpdateCriticalState(StatIndex);
+	}
 }
 
 void UTFStatsComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	StopDecayTimers();
+	UnregisterStatRows();
 
 	Super::EndPlay(EndPlayReason);
 }
 
-void UTFStatsComponent::StartDecayTimers()
+void UTFStatsComponent::PostLoad()
+{
+	Super::PostLoad();
+
+#if WITH_EDITORONLY_DATA
+	// Assets saved before StatDefinitions still carry the per-stat fields
+	FoldDeprecatedStat(StatDefinitions, TFStatNames::Hunger, MaxHunger_DEPRECATED, HungerDecayAmount_DEPRECATED, HungerDecayInterval_DEPRECATED, HungerCriticalThreshold_DEPRECATED);
+	FoldDeprecatedStat(StatDefinitions, TFStatNames::Thirst, MaxThirst_DEPRECATED, ThirstDecayAmount_DEPRECATED, ThirstDecayInterval_DEPRECATED, ThirstCriticalThreshold_DEPRECATED);
+#endif
+}
+
+void UTFStatsComponent::RegisterStatRows()
 {
 	UWorld* World = GetWorld();
-	if (!World)
+	UTFStatsSubsystem* Subsystem = World ? World->GetSubsystem<UTFStatsSubsystem>() : nullptr;
+
+	ActiveDefinitions = StatDefinitions;
+
+	if (Subsystem && bUseStatConfig)
+	{
+		for (const FTFStatDefinition& Configured : Subsystem->GetConfiguredStats())
+		{
+			if (FTFStatDefinition* Existing = ActiveDefinitions.FindByPredicate([&Configured](const FTFStatDefinition& Definition) { return Definition.StatName == Configured.StatName; }))
+			{
+				*Existing = Configured;
+			}
+			else
+			{
+				ActiveDefinitions.Add(Configured);
+			}
+		}
+	}
+
+	StatStates.Reset();
+	StatStates.SetNum(ActiveDefinitions.Num());
+
+	if (!Subsystem)
 	{
 		return;
 	}
 
-	// Start hunger decay timer
-	World->GetTimerManager().SetTimer(
-		HungerDecayTimerHandle,
-		this,
-		&UTFStatsComponent::DecayHunger,
-		HungerDecayInterval,
-		true
-	);
-
-	// Start thirst decay timer
-	World->GetTimerManager().SetTimer(
-		ThirstDecayTimerHandle,
-		this,
-		&UTFStatsComponent::DecayThirst,
-		ThirstDecayInterval,
-		true
-	);
+	StatsSubsystem = Subsystem;
+
+	for (int32 StatIndex = 0; StatIndex < ActiveDefinitions.Num(); ++StatIndex)
+	{
+		FTFStatDefinition& Definition = ActiveDefinitions[StatIndex];
+		Definition.MaxValue = FMath::Max(1.0f, Definition.MaxValue);
+
+		// Rows start at max unless the definition says otherwise
+		const float InitialValue = Definition.InitialValue < 0.0f ? Definition.MaxValue : Definition.InitialValue;
+		StatStates[StatIndex].Row = Subsystem->RegisterStat(this, StatIndex, InitialValue, Definition.MaxValue, Definition.DecayAmount, Definition.DecayInterval);
+	}
 }
 
-void UTFStatsComponent::StopDecayTimers()
+void UTFStatsComponent::UnregisterStatRows()
 {
 	UWorld* World = GetWorld();
-	if (!World)
+	UTFStatsSubsystem* Subsystem = StatsSubsystem.Get();
+
+	for (FStatState& State : StatStates)
 	{
-		return;
+		if (World)
+		{
+			World->GetTimerManager().ClearTimer(State.ThresholdTimer);
+		}
+
+		// Unregistering one row can move another of ours, so re-read the index each time
+		if (Subsystem && State.Row != INDEX_NONE)
+		{
+			const int32 Row = State.Row;
+			State.Row = INDEX_NONE;
+			Subsystem->UnregisterStat(Row);
+		}
+
+		State.Row = INDEX_NONE;
 	}
 
-	World->GetTimerManager().ClearTimer(HungerDecayTimerHandle);
-	World->GetTimerManager().ClearTimer(ThirstDecayTimerHandle);
+	StatsSubsystem.Reset();
 }
 
-void UTFStatsComponent::DecayHunger()
+void UTFStatsComponent::HandleStatDecayed(int32 StatIndex)
 {
-	ConsumeHunger(HungerDecayAmount);
+	if (StatStates.IsValidIndex(StatIndex))
+	{
+		BroadcastStatChanged(StatIndex);
+		UpdateCriticalState(StatIndex);
+	}
 }
 
-void UTFStatsComponent::DecayThirst()
+void UTFStatsComponent::HandleStatRowMoved(int32 StatIndex, int32 NewRow)
 {
-	ConsumeThirst(ThirstDecayAmount);
+	if (StatStates.IsValidIndex(StatIndex))
+	{
+		StatStates[StatIndex].Row = NewRow;
+	}
 }
 
-void UTFStatsComponent::UpdateHungerCriticalState()
+void UTFStatsComponent::ScheduleThresholdTimer(int32 StatIndex)
 {
-	float HungerPercent = GetHungerPercent();
-	bool bWasCritical = bIsHungerCritical;
+	UWorld* World = GetWorld();
+	const UTFStatsSubsystem* Subsystem = StatsSubsystem.Get();
+	if (!World || !Subsystem || !Subsystem->IsAnalyticDecay())
+	{
+		return;
+	}
 
-	bIsHungerCritical = HungerPercent <= HungerCriticalThreshold && HungerPercent > 0.0f;
+	FStatState& State = StatStates[StatIndex];
+	World->GetTimerManager().ClearTimer(State.ThresholdTimer);
 
-	// Broadcast critical event when entering critical state
-	if (bIsHungerCritical && !bWasCritical)
+	if (State.Row == INDEX_NONE || State.bIsDepleted)
 	{
-		OnStatCritical.Broadcast(TFStatNames::Hunger, HungerPercent);
+		return;
 	}
 
-	// Check for depletion
-	bool bWasDepleted = bIsHungerDepleted;
-	bIsHungerDepleted = CurrentHunger <= 0.0f;
-
-	if (bIsHungerDepleted && !bWasDepleted)
+	// Once critical, the only crossing left is depletion
+	const FTFStatDefinition& Definition = ActiveDefinitions[StatIndex];
+	const float TargetValue = State.bIsCritical ? 0.0f : Definition.CriticalThreshold * Definition.MaxValue;
+	const float Delay = Subsystem->GetTimeUntilValue(State.Row, TargetValue);
+	if (Delay < 0.0f)
 	{
-		OnStatDepleted.Broadcast(TFStatNames::Hunger);
+		return;
 	}
+
+	World->GetTimerManager().SetTimer(State.ThresholdTimer, FTimerDelegate::CreateUObject(this, &UTFStatsComponent::HandleStatDecayed, StatIndex), FMath::Max(Delay, 0.01f), false);
 }
 
-void UTFStatsComponent::UpdateThirstCriticalState()
+void UTFStatsComponent::BroadcastStatChanged(int32 StatIndex)
 {
-	float ThirstPercent = GetThirstPercent();
-	bool bWasCritical = bIsThirstCritical;
+	const FName StatName = ActiveDefinitions[StatIndex].StatName;
+	const float Value = GetStatValueAt(StatIndex);
+	const float MaxValue = ActiveDefinitions[StatIndex].MaxValue;
 
-	bIsThirstCritical = ThirstPercent <= ThirstCriticalThreshold && ThirstPercent > 0.0f;
+	OnStatChanged.Broadcast(StatName, Value, MaxValue);
 
-	// Broadcast critical event when entering critical state
-	if (bIsThirstCritical && !bWasCritical)
+	if (StatName == TFStatNames::Hunger)
 	{
-		OnStatCritical.Broadcast(TFStatNames::Thirst, ThirstPercent);
+		OnHungerChanged.Broadcast(Value, MaxValue);
 	}
-
-	// Check for depletion
-	bool bWasDepleted = bIsThirstDepleted;
-	bIsThirstDepleted = CurrentThirst <= 0.0f;
-
-	if (bIsThirstDepleted && !bWasDepleted)
+	else if (StatName == TFStatNames::Thirst)
 	{
-		OnStatDepleted.Broadcast(TFStatNames::Thirst);
+		OnThirstChanged.Broadcast(Value, MaxValue);
 	}
 }
 
-#pragma region Hunger Functions
-
-void UTFStatsComponent::ConsumeHunger(float Amount)
+float UTFStatsComponent::GetStatValueAt(int32 StatIndex) const
 {
-	if (Amount <= 0.0f)
+	const UTFStatsSubsystem* Subsystem = StatsSubsystem.Get();
+	const int32 Row = StatStates.IsValidIndex(StatIndex) ? StatStates[StatIndex].Row : INDEX_NONE;
+	if (Subsystem && Row != INDEX_NONE)
 	{
-		return;
+		return Subsystem->GetValue(Row);
 	}
 
-	float OldHunger = CurrentHunger;
-	CurrentHunger = FMath::Clamp(CurrentHunger - Amount, 0.0f, MaxHunger);
+	const FTFStatDefinition& Definition = ActiveDefinitions[StatIndex];
+	return Definition.InitialValue < 0.0f ? Definition.MaxValue : Definition.InitialValue;
+}
+
+void UTFStatsComponent::SetStatValueAt(int32 StatIndex, float NewValue)
+{
+	UTFStatsSubsystem* Subsystem = StatsSubsystem.Get();
+	const int32 Row = StatStates[StatIndex].Row;
 
-	if (OldHunger != CurrentHunger)
+	if (Subsystem && Row != INDEX_NONE && Subsystem->SetValue(Row, NewValue))
 	{
-		OnHungerChanged.Broadcast(CurrentHunger, MaxHunger);
-		UpdateHungerCriticalState();
+		BroadcastStatChanged(StatIndex);
+		UpdateCriticalState(StatIndex);
 	}
 }
 
-void UTFStatsComponent::RestoreHunger(float Amount)
+void UTFStatsComponent::UpdateCriticalState(int32 StatIndex)
 {
-	if (Amount <= 0.0f)
+	const FTFStatDefinition& Definition = ActiveDefinitions[StatIndex];
+	FStatState& State = StatStates[StatIndex];
+
+	const float Percent = GetStatValueAt(StatIndex) / Definition.MaxValue;
+	const bool bWasCritical = State.bIsCritical;
+
+	State.bIsCritical = Percent <= Definition.CriticalThreshold && Percent > 0.0f;
+
+	// Broadcast critical event when entering critical state
+	if (State.bIsCritical && !bWasCritical)
 	{
-		return;
+		OnStatCritical.Broadcast(Definition.StatName, Percent);
 	}
 
-	float OldHunger = CurrentHunger;
-	CurrentHunger = FMath::Clamp(CurrentHunger + Amount, 0.0f, MaxHunger);
+	// Check for depletion
+	const bool bWasDepleted = State.bIsDepleted;
+	State.bIsDepleted = Percent <= 0.0f;
 
-	if (OldHunger != CurrentHunger)
+	if (State.bIsDepleted && !bWasDepleted)
 	{
-		OnHungerChanged.Broadcast(CurrentHunger, MaxHunger);
-		UpdateHungerCriticalState();
+		OnStatDepleted.Broadcast(Definition.StatName);
 	}
+
+	ScheduleThresholdTimer(StatIndex);
 }
 
-void UTFStatsComponent::SetHunger(float NewHunger)
+#pragma region Generic Stats
+
+int32 UTFStatsComponent::FindStat(FName StatName) const
 {
-	float OldHunger = CurrentHunger;
-	CurrentHunger = FMath::Clamp(NewHunger, 0.0f, MaxHunger);
+	return ActiveDefinitions.IndexOfByPredicate([StatName](const FTFStatDefinition& Definition)
+	{
+		return Definition.StatName == StatName;
+	});
+}
 
-	if (OldHunger != CurrentHunger)
+const FTFStatDefinition* UTFStatsComponent::FindDefinition(FName StatName) const
+{
+	const int32 StatIndex = FindStat(StatName);
+	if (StatIndex != INDEX_NONE)
 	{
-		OnHungerChanged.Broadcast(CurrentHunger, MaxHunger);
-		UpdateHungerCriticalState();
+		return &ActiveDefinitions[StatIndex];
 	}
+
+	// Before BeginPlay only the defaults are known
+	return StatDefinitions.FindByPredicate([StatName](const FTFStatDefinition& Definition)
+	{
+		return Definition.StatName == StatName;
+	});
 }
 
-void UTFStatsComponent::FullyRestoreHunger()
+float UTFStatsComponent::GetStatValue(FName StatName) const
 {
-	SetHunger(MaxHunger);
+	const int32 StatIndex = FindStat(StatName);
+	if (StatIndex != INDEX_NONE)
+	{
+		return GetStatValueAt(StatIndex);
+	}
+
+	const FTFStatDefinition* Definition = FindDefinition(StatName);
+	return Definition ? (Definition->InitialValue < 0.0f ? Definition->MaxValue : Definition->InitialValue) : 0.0f;
 }
 
-#pragma endregion Hunger Functions
+float UTFStatsComponent::GetStatMax(FName StatName) const
+{
+	const FTFStatDefinition* Definition = FindDefinition(StatName);
+	return Definition ? Definition->MaxValue : 0.0f;
+}
 
-#pragma region Thirst Functions
+float UTFStatsComponent::GetStatPercent(FName StatName) const
+{
+	const float MaxValue = GetStatMax(StatName);
+	return MaxValue > 0.0f ? (GetStatValue(StatName) / MaxValue) : 0.0f;
+}
 
-void UTFStatsComponent::ConsumeThirst(float Amount)
+bool UTFStatsComponent::IsStatCritical(FName StatName) const
+{
+	const int32 StatIndex = FindStat(StatName);
+	return StatIndex != INDEX_NONE && StatStates[StatIndex].bIsCritical;
+}
+
+bool UTFStatsComponent::IsStatDepleted(FName StatName) const
 {
-	if (Amount <= 0.0f)
+	const int32 StatIndex = FindStat(StatName);
+	return StatIndex != INDEX_NONE && StatStates[StatIndex].bIsDepleted;
+}
+
+void UTFStatsComponent::SetStatValue(FName StatName, float NewValue)
+{
+	const int32 StatIndex = FindStat(StatName);
+	if (StatIndex != INDEX_NONE)
 	{
-		return;
+		SetStatValueAt(StatIndex, NewValue);
 	}
+}
 
-	float OldThirst = CurrentThirst;
-	CurrentThirst = FMath::Clamp(CurrentThirst - Amount, 0.0f, MaxThirst);
-
-	if (OldThirst != CurrentThirst)
+void UTFStatsComponent::ModifyStat(FName StatName, float Delta)
+{
+	const int32 StatIndex = FindStat(StatName);
+	if (StatIndex != INDEX_NONE && Delta != 0.0f)
 	{
-		OnThirstChanged.Broadcast(CurrentThirst, MaxThirst);
-		UpdateThirstCriticalState();
+		SetStatValueAt(StatIndex, GetStatValueAt(StatIndex) + Delta);
 	}
 }
 
-void UTFStatsComponent::RestoreThirst(float Amount)
+void UTFStatsComponent::SetStatMax(FName StatName, float NewMax)
 {
-	if (Amount <= 0.0f)
+	const int32 StatIndex = FindStat(StatName);
+	if (StatIndex == INDEX_NONE)
 	{
+		// Not registered yet; adjust the default so BeginPlay picks it up
+		if (FTFStatDefinition* Definition = StatDefinitions.FindByPredicate([StatName](const FTFStatDefinition& Entry) { return Entry.StatName == StatName; }))
+		{
+			Definition->MaxValue = FMath::Max(1.0f, NewMax);
+		}
 		return;
 	}
 
-	float OldThirst = CurrentThirst;
-	CurrentThirst = FMath::Clamp(CurrentThirst + Amount, 0.0f, MaxThirst);
+	FTFStatDefinition& Definition = ActiveDefinitions[StatIndex];
+	Definition.MaxValue = FMath::Max(1.0f, NewMax);
 
-	if (OldThirst != CurrentThirst)
+	if (UTFStatsSubsystem* Subsystem = StatsSubsystem.Get(); Subsystem && StatStates[StatIndex].Row != INDEX_NONE)
 	{
-		OnThirstChanged.Broadcast(CurrentThirst, MaxThirst);
-		UpdateThirstCriticalState();
+		Subsystem->SetMaxValue(StatStates[StatIndex].Row, Definition.MaxValue);
 	}
+
+	BroadcastStatChanged(StatIndex);
+	UpdateCriticalState(StatIndex);
 }
 
-void UTFStatsComponent::SetThirst(float NewThirst)
+void UTFStatsComponent::SetStatDecayRate(FName StatName, float DecayAmount, float DecayInterval)
 {
-	float OldThirst = CurrentThirst;
-	CurrentThirst = FMath::Clamp(NewThirst, 0.0f, MaxThirst);
-
-	if (OldThirst != CurrentThirst)
+	const int32 StatIndex = FindStat(StatName);
+	if (StatIndex == INDEX_NONE)
 	{
-		OnThirstChanged.Broadcast(CurrentThirst, MaxThirst);
-		UpdateThirstCriticalState();
+		if (FTFStatDefinition* Definition = StatDefinitions.FindByPredicate([StatName](const FTFStatDefinition& Entry) { return Entry.StatName == StatName; }))
+		{
+			Definition->DecayAmount = FMath::Max(0.0f, DecayAmount);
+			Definition->DecayInterval = FMath::Max(0.1f, DecayInterval);
+		}
+		return;
 	}
-}
 
-void UTFStatsComponent::FullyRestoreThirst()
-{
-	SetThirst(MaxThirst);
-}
+	FTFStatDefinition& Definition = ActiveDefinitions[StatIndex];
+	Definition.DecayAmount = FMath::Max(0.0f, DecayAmount);
+	Definition.DecayInterval = FMath::Max(0.1f, DecayInterval);
 
-#pragma endregion Thirst Functions
+	// Restarts the decay interval
+	if (UTFStatsSubsystem* Subsystem = StatsSubsystem.Get(); Subsystem && StatStates[StatIndex].Row != INDEX_NONE)
+	{
+		Subsystem->SetDecayRate(StatStates[StatIndex].Row, Definition.DecayAmount, Definition.DecayInterval);
+	}
 
-#pragma region Queries
+	UpdateCriticalState(StatIndex);
+}
 
-float UTFStatsComponent::GetHungerPercent() const
+void UTFStatsComponent::SetDecayPaused(bool bPaused)
 {
-	return MaxHunger > 0.0f ? (CurrentHunger / MaxHunger) : 0.0f;
+	UTFStatsSubsystem* Subsystem = StatsSubsystem.Get();
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	for (int32 StatIndex = 0; StatIndex < StatStates.Num(); ++StatIndex)
+	{
+		if (StatStates[StatIndex].Row != INDEX_NONE)
+		{
+			Subsystem->SetPaused(StatStates[StatIndex].Row, bPaused);
+			UpdateCriticalState(StatIndex);
+		}
+	}
 }
 
-float UTFStatsComponent::GetThirstPercent() const
+bool UTFStatsComponent::IsAnalyticDecay() const
 {
-	return MaxThirst > 0.0f ? (CurrentThirst / MaxThirst) : 0.0f;
+	const UTFStatsSubsystem* Subsystem = StatsSubsystem.Get();
+	return Subsystem && Subsystem->IsAnalyticDecay();
 }
 
-#pragma endregion Queries
+#pragma endregion Generic Stats
 
-#pragma region Configuration
+#pragma region Hunger Functions
 
-void UTFStatsComponent::SetMaxHunger(float NewMax)
+void UTFStatsComponent::ConsumeHunger(float Amount)
 {
-	MaxHunger = FMath::Max(1.0f, NewMax);
-	CurrentHunger = FMath::Min(CurrentHunger, MaxHunger);
-	OnHungerChanged.Broadcast(CurrentHunger, MaxHunger);
+	if (Amount > 0.0f)
+	{
+		ModifyStat(TFStatNames::Hunger, -Amount);
+	}
 }
 
-void UTFStatsComponent::SetHungerDecayRate(float DecayAmount, float DecayInterval)
+void UTFStatsComponent::RestoreHunger(float Amount)
 {
-	HungerDecayAmount = FMath::Max(0.0f, DecayAmount);
-	HungerDecayInterval = FMath::Max(0.1f, DecayInterval);
-
-	// Restart hunger timer with new interval
-	UWorld* World = GetWorld();
-	if (World)
+	if (Amount > 0.0f)
 	{
-		World->GetTimerManager().ClearTimer(HungerDecayTimerHandle);
-		World->GetTimerManager().SetTimer(
-			HungerDecayTimerHandle,
-			this,
-			&UTFStatsComponent::DecayHunger,
-			HungerDecayInterval,
-			true
-		);
+		ModifyStat(TFStatNames::Hunger, Amount);
 	}
 }
 
-void UTFStatsComponent::SetMaxThirst(float NewMax)
-{
-	MaxThirst = FMath::Max(1.0f, NewMax);
-	CurrentThirst = FMath::Min(CurrentThirst, MaxThirst);
-	OnThirstChanged.Broadcast(CurrentThirst, MaxThirst);
-}
+#pragma endregion Hunger Functions
 
-void UTFStatsComponent::SetThirstDecayRate(float DecayAmount, float DecayInterval)
-{
-	ThirstDecayAmount = FMath::Max(0.0f, DecayAmount);
-	ThirstDecayInterval = FMath::Max(0.1f, DecayInterval);
+#pragma region Thirst Functions
 
-	// Restart thirst timer with new interval
-	UWorld* World = GetWorld();
-	if (World)
+void UTFStatsComponent::ConsumeThirst(float Amount)
+{
+	if (Amount > 0.0f)
 	{
-		World->GetTimerManager().ClearTimer(ThirstDecayTimerHandle);
-		World->GetTimerManager().SetTimer(
-			ThirstDecayTimerHandle,
-			this,
-			&UTFStatsComponent::DecayThirst,
-			ThirstDecayInterval,
-			true
-		);
+		ModifyStat(TFStatNames::Thirst, -Amount);
 	}
 }
 
-void UTFStatsComponent::SetDecayPaused(bool bPaused)
+void UTFStatsComponent::RestoreThirst(float Amount)
 {
-	UWorld* World = GetWorld();
-	if (!World)
-	{
-		return;
-	}
-
-	if (bPaused)
-	{
-		World->GetTimerManager().PauseTimer(HungerDecayTimerHandle);
-		World->GetTimerManager().PauseTimer(ThirstDecayTimerHandle);
-	}
-	else
+	if (Amount > 0.0f)
 	{
-		World->GetTimerManager().UnPauseTimer(HungerDecayTimerHandle);
-		World->GetTimerManager().UnPauseTimer(ThirstDecayTimerHandle);
+		ModifyStat(TFStatNames::Thirst, Amount);
 	}
 }
 
-#pragma endregion Configuration
+#pragma endregion Thirst Functions
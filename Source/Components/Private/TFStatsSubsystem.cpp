@@ -0,0 +1,317 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFStatsSubsystem.h"
+#include "TFStatsComponent.h"
+#include "TFTypes.h"
+#include "TFStats.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+namespace
+{
+	constexpr int32 DecayChunkSize = 256;
+}
+
+bool UTFStatsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTFStatsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	LoadStatConfig();
+}
+
+void UTFStatsSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(DecayTimerHandle);
+	}
+
+	Super::Deinitialize();
+}
+
+void UTFStatsSubsystem::LoadStatConfig()
+{
+	ConfiguredStats.Reset();
+
+	TArray<FString> SectionNames;
+	FString ConfigFilePath;
+	if (!TFConfigUtils::GetINISectionNames(TEXT("StatConfig.ini"), SectionNames, ConfigFilePath, LogTFStats, true))
+	{
+		return;
+	}
+
+	for (const FString& SectionName : SectionNames)
+	{
+		FTFStatDefinition& Definition = ConfiguredStats.AddDefaulted_GetRef();
+		Definition.StatName = FName(*SectionName);
+
+		// Missing keys keep the struct defaults
+		GConfig->GetFloat(*SectionName, TEXT("MaxValue"), Definition.MaxValue, ConfigFilePath);
+		GConfig->GetFloat(*SectionName, TEXT("InitialValue"), Definition.InitialValue, ConfigFilePath);
+		GConfig->GetFloat(*SectionName, TEXT("DecayAmount"), Definition.DecayAmount, ConfigFilePath);
+		GConfig->GetFloat(*SectionName, TEXT("DecayInterval"), Definition.DecayInterval, ConfigFilePath);
+		GConfig->GetFloat(*SectionName, TEXT("CriticalThreshold"), Definition.CriticalThreshold, ConfigFilePath);
+	}
+
+	UE_LOG(LogTFStats, Log, TEXT("UTFStatsSubsystem: Loaded %d stat definitions from StatConfig.ini"), ConfiguredStats.Num());
+}
+
+#pragma region Registration
+
+int32 UTFStatsSubsystem::RegisterStat(UTFStatsComponent* Owner, int32 StatIndex, float InitialValue, float MaxValue, float DecayAmount, float DecayInterval)
+{
+	const float ClampedMax = FMath::Max(1.0f, MaxValue);
+
+	const int32 Row = Values.Add(FMath::Clamp(InitialValue, 0.0f, ClampedMax));
+	MaxValues.Add(ClampedMax);
+	DecayAmounts.Add(FMath::Max(0.0f, DecayAmount));
+	DecayIntervals.Add(FMath::Max(0.1f, DecayInterval));
+	DecayElapsed.Add(0.0f);
+	BaseTimes.Add(GetTime());
+	PausedFlags.Add(0);
+	ChangedFlags.Add(0);
+	RowStatIndices.Add(StatIndex);
+	RowOwners.Add(Owner);
+
+	UWorld* World = GetWorld();
+	if (World && !bAnalyticDecay && !World->GetTimerManager().IsTimerActive(DecayTimerHandle))
+	{
+		World->GetTimerManager().SetTimer(DecayTimerHandle, this, &UTFStatsSubsystem::RunDecayPass, DecayBatchInterval, true);
+	}
+
+	return Row;
+}
+
+void UTFStatsSubsystem::UnregisterStat(int32 Row)
+{
+	if (!Values.IsValidIndex(Row))
+	{
+		return;
+	}
+
+	const int32 LastRow = Values.Num() - 1;
+	if (Row != LastRow && RowOwners[LastRow])
+	{
+		RowOwners[LastRow]->HandleStatRowMoved(RowStatIndices[LastRow], Row);
+	}
+
+	Values.RemoveAtSwap(Row);
+	MaxValues.RemoveAtSwap(Row);
+	DecayAmounts.RemoveAtSwap(Row);
+	DecayIntervals.RemoveAtSwap(Row);
+	DecayElapsed.RemoveAtSwap(Row);
+	BaseTimes.RemoveAtSwap(Row);
+	PausedFlags.RemoveAtSwap(Row);
+	ChangedFlags.RemoveAtSwap(Row);
+	RowStatIndices.RemoveAtSwap(Row);
+	RowOwners.RemoveAtSwap(Row);
+
+	if (Values.Num() == 0)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			World->GetTimerManager().ClearTimer(DecayTimerHandle);
+		}
+	}
+}
+
+#pragma endregion Registration
+
+#pragma region Decay
+
+void UTFStatsSubsystem::RunDecayPass()
+{
+	const int32 NumRows = Values.Num();
+	if (NumRows == 0)
+	{
+		return;
+	}
+
+	TF_SCOPE_CYCLE_COUNTER(StatDecay);
+	INC_DWORD_STAT_BY(STAT_TFStatRowsDecayed, NumRows);
+
+	const float DeltaSeconds = DecayBatchInterval;
+
+	if (NumRows >= ParallelRowThreshold)
+	{
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumRows, DecayChunkSize);
+		ParallelFor(NumChunks, [this, NumRows, DeltaSeconds](int32 ChunkIndex)
+		{
+			const int32 FirstRow = ChunkIndex * DecayChunkSize;
+			DecayRows(FirstRow, FMath::Min(FirstRow + DecayChunkSize, NumRows), DeltaSeconds);
+		});
+	}
+	else
+	{
+		DecayRows(0, NumRows, DeltaSeconds);
+	}
+
+	// Collect first: listeners may register or unregister rows while being notified
+	TArray<TPair<TWeakObjectPtr<UTFStatsComponent>, int32>, TInlineAllocator<16>> ChangedStats;
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		if (ChangedFlags[Row])
+		{
+			ChangedFlags[Row] = 0;
+			ChangedStats.Emplace(RowOwners[Row], RowStatIndices[Row]);
+		}
+	}
+
+	for (const TPair<TWeakObjectPtr<UTFStatsComponent>, int32>& Changed : ChangedStats)
+	{
+		if (UTFStatsComponent* Owner = Changed.Key.Get())
+		{
+			Owner->HandleStatDecayed(Changed.Value);
+		}
+	}
+}
+
+void UTFStatsSubsystem::DecayRows(int32 FirstRow, int32 EndRow, float DeltaSeconds)
+{
+	float* RESTRICT ValueData = Values.GetData();
+	float* RESTRICT ElapsedData = DecayElapsed.GetData();
+	uint8* RESTRICT ChangedData = ChangedFlags.GetData();
+	const float* RESTRICT AmountData = DecayAmounts.GetData();
+	const float* RESTRICT IntervalData = DecayIntervals.GetData();
+	const uint8* RESTRICT PausedData = PausedFlags.GetData();
+
+	// Branch-free over every stat type so the compiler can vectorize; paused rows advance by zero
+	for (int32 Row = FirstRow; Row < EndRow; ++Row)
+	{
+		const float Active = PausedData[Row] ? 0.0f : 1.0f;
+		const float Elapsed = ElapsedData[Row] + DeltaSeconds * Active;
+		const float Steps = FMath::FloorToFloat(Elapsed / IntervalData[Row]);
+		ElapsedData[Row] = Elapsed - Steps * IntervalData[Row];
+
+		const float NewValue = FMath::Max(0.0f, ValueData[Row] - Steps * AmountData[Row]);
+		ChangedData[Row] = NewValue != ValueData[Row] ? 1 : 0;
+		ValueData[Row] = NewValue;
+	}
+}
+
+#pragma endregion Decay
+
+#pragma region Analytic Decay
+
+double UTFStatsSubsystem::GetTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+float UTFStatsSubsystem::GetElapsedSteps(int32 Row, double Now) const
+{
+	if (PausedFlags[Row] || DecayAmounts[Row] <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	// Small bias so a threshold timer firing exactly on a step boundary sees that step
+	return FMath::FloorToFloat(static_cast<float>((Now - BaseTimes[Row]) / DecayIntervals[Row]) + KINDA_SMALL_NUMBER);
+}
+
+void UTFStatsSubsystem::FoldRow(int32 Row)
+{
+	if (!bAnalyticDecay || PausedFlags[Row])
+	{
+		return;
+	}
+
+	const float Steps = GetElapsedSteps(Row, GetTime());
+	if (Steps > 0.0f)
+	{
+		Values[Row] = FMath::Max(0.0f, Values[Row] - Steps * DecayAmounts[Row]);
+		BaseTimes[Row] += Steps * DecayIntervals[Row];
+	}
+}
+
+float UTFStatsSubsystem::GetTimeUntilValue(int32 Row, float TargetValue) const
+{
+	if (!bAnalyticDecay || PausedFlags[Row] || DecayAmounts[Row] <= 0.0f)
+	{
+		return -1.0f;
+	}
+
+	const double Now = GetTime();
+	if (GetValue(Row) <= TargetValue)
+	{
+		return 0.0f;
+	}
+
+	const float StepsNeeded = FMath::CeilToFloat((Values[Row] - FMath::Max(0.0f, TargetValue)) / DecayAmounts[Row]);
+	return FMath::Max(0.0f, static_cast<float>(BaseTimes[Row] + StepsNeeded * DecayIntervals[Row] - Now));
+}
+
+#pragma endregion Analytic Decay
+
+#pragma region Row Access
+
+float UTFStatsSubsystem::GetValue(int32 Row) const
+{
+	if (!bAnalyticDecay)
+	{
+		return Values[Row];
+	}
+
+	return FMath::Max(0.0f, Values[Row] - GetElapsedSteps(Row, GetTime()) * DecayAmounts[Row]);
+}
+
+bool UTFStatsSubsystem::SetValue(int32 Row, float NewValue)
+{
+	FoldRow(Row);
+
+	const float ClampedValue = FMath::Clamp(NewValue, 0.0f, MaxValues[Row]);
+	if (ClampedValue == Values[Row])
+	{
+		return false;
+	}
+
+	Values[Row] = ClampedValue;
+	return true;
+}
+
+void UTFStatsSubsystem::SetMaxValue(int32 Row, float NewMax)
+{
+	FoldRow(Row);
+
+	MaxValues[Row] = FMath::Max(1.0f, NewMax);
+	Values[Row] = FMath::Min(Values[Row], MaxValues[Row]);
+}
+
+void UTFStatsSubsystem::SetDecayRate(int32 Row, float DecayAmount, float DecayInterval)
+{
+	FoldRow(Row);
+
+	DecayAmounts[Row] = FMath::Max(0.0f, DecayAmount);
+	DecayIntervals[Row] = FMath::Max(0.1f, DecayInterval);
+	DecayElapsed[Row] = 0.0f;
+	BaseTimes[Row] = GetTime();
+}
+
+void UTFStatsSubsystem::SetPaused(int32 Row, bool bPaused)
+{
+	if (bAnalyticDecay && bPaused != (PausedFlags[Row] != 0))
+	{
+		// Carry the partial step across the pause, as the batched pass does through DecayElapsed
+		const double Now = GetTime();
+		if (bPaused)
+		{
+			FoldRow(Row);
+			DecayElapsed[Row] = static_cast<float>(Now - BaseTimes[Row]);
+		}
+		else
+		{
+			BaseTimes[Row] = Now - DecayElapsed[Row];
+		}
+	}
+
+	PausedFlags[Row] = bPaused ? 1 : 0;
+}
+
+#pragma endregion Row Access
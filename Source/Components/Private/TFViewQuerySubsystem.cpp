@@ -0,0 +1,91 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFViewQuerySubsystem.h"
+#include "TFStats.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+CSV_DEFINE_CATEGORY(TFViewQuery, true);
+
+void UTFViewQuerySubsystem::Deinitialize()
+{
+	Queries.Empty();
+
+	Super::Deinitialize();
+}
+
+UTFViewQuerySubsystem* UTFViewQuerySubsystem::Get(const APlayerController* PC)
+{
+	const ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+	return LocalPlayer ? LocalPlayer->GetSubsystem<UTFViewQuerySubsystem>() : nullptr;
+}
+
+const FTFViewQueryResult* UTFViewQuerySubsystem::QueryView(ECollisionChannel Channel, bool bTraceComplex, float Distance)
+{
+	// Requests: scene queries consumers would issue on their own; Traces: queries actually run
+	INC_DWORD_STAT(STAT_TFViewQueryRequests);
+	CSV_CUSTOM_STAT(TFViewQuery, Requests, 1, ECsvCustomStatOp::Accumulate);
+
+	const ULocalPlayer* LocalPlayer = GetLocalPlayer<ULocalPlayer>();
+	UWorld* World = LocalPlayer ? LocalPlayer->GetWorld() : nullptr;
+	APlayerController* PC = World ? LocalPlayer->GetPlayerController(World) : nullptr;
+	if (!PC)
+	{
+		return nullptr;
+	}
+
+	const FQueryKey Key{Channel, bTraceComplex};
+	FTFViewQueryResult& Result = Queries.FindOrAdd(Key);
+
+	if (Result.FrameNumber != GFrameCounter)
+	{
+		// First request this frame: trace only as far as this requester needs
+		PC->GetPlayerViewPoint(Result.ViewLocation, Result.ViewRotation);
+		Result.FrameNumber = GFrameCounter;
+		RunQuery(PC, Result, Key, 0.0f, Distance);
+	}
+	else if (!Result.bHit && Result.TraceDistance < Distance)
+	{
+		// A hit already found is the first along the ray for any longer request too
+		RunQuery(PC, Result, Key, Result.TraceDistance, Distance);
+	}
+
+	return &Result;
+}
+
+void UTFViewQuerySubsystem::RunQuery(APlayerController* PC, FTFViewQueryResult& Result, const FQueryKey& Key, float StartDistance, float Distance) const
+{
+	INC_DWORD_STAT(STAT_TFViewQueryTraces);
+	CSV_CUSTOM_STAT(TFViewQuery, Traces, 1, ECsvCustomStatOp::Accumulate);
+
+	const FVector Direction = Result.ViewRotation.Vector();
+	Result.TraceDistance = Distance;
+	Result.Hit = FHitResult();
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TFViewQueryTrace), Key.bTraceComplex);
+	if (APawn* Pawn = PC->GetPawn())
+	{
+		QueryParams.AddIgnoredActor(Pawn);
+	}
+
+	Result.bHit = PC->GetWorld()->LineTraceSingleByChannel(
+		Result.Hit,
+		Result.ViewLocation + Direction * StartDistance,
+		Result.GetTraceEnd(),
+		Key.Channel,
+		QueryParams
+	);
+
+	if (StartDistance > 0.0f)
+	{
+		// Report the extension as one trace from the view point
+		Result.Hit.TraceStart = Result.ViewLocation;
+		if (Result.bHit)
+		{
+			Result.Hit.Distance += StartDistance;
+			Result.Hit.Time = Result.Hit.Distance / Distance;
+		}
+	}
+}
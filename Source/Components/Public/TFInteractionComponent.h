@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "WorldCollision.h"
 #include "TFInteractableInterface.h"
 #include "TFInteractionComponent.generated.h"
 
@@ -37,6 +38,10 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Interaction|Detection")
 	bool bTraceComplex = false;
 
+	/** Issue detection traces asynchronously and apply the result on the next frame */
+	UPROPERTY(EditAnywhere, Category = "Interaction|Detection")
+	bool bUseAsyncTrace = false;
+
 #pragma endregion Detection Settings
 
 #pragma region State
@@ -52,6 +57,11 @@ private:
 
 	FInteractionData CurrentInteractionData;
 
+	/** In-flight async detection trace; reset when a newer synchronous check supersedes it */
+	FTraceHandle PendingTraceHandle;
+
+	FTraceDelegate AsyncTraceDelegate;
+
 #pragma endregion State
 
 protected:
@@ -59,6 +69,10 @@ protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	void PerformInteractionCheck();
+	void RunInteractionCheck(bool bAllowAsync);
+	bool TraceForInteractable(FHitResult& OutHitResult) const;
+	void RequestAsyncTrace();
+	void OnAsyncTraceComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
 	bool GetTracePoints(FVector& TraceStart, FVector& TraceEnd) const;
 	void ProcessHitResult(const FHitResult& HitResult);
 	void UpdateFocusedActor(AActor* NewFocus);
@@ -92,6 +106,9 @@ public:
 	bool HasInteractable() const { return CurrentInteractable.IsValid(); }
 	FInteractionData GetCurrentInteractionData() const { return CurrentInteractionData; }
 
+	/** Cheap grid check: false when no interactable can be within detection reach */
+	bool HasInteractableInRange() const;
+
 #pragma endregion Queries
 
 #pragma region Configuration
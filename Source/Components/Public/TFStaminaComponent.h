@@ -27,7 +27,11 @@ class COMPONENTS_API UTFStaminaComponent : public UActorComponent
 
 private:
 
-	FTimerHandle DrainTimerHandle;
+	/** Drain per second requested by StartStaminaDrain, applied in the tick */
+	float ActiveDrainRate = 0.0f;
+
+	/** Value sent with the last OnStaminaChanged */
+	float LastBroadcastStamina = -1.0f;
 
 #pragma region Stamina Values
 
@@ -113,6 +117,14 @@ public:
 
 #pragma endregion Visual Feedback
 
+#pragma region Broadcast
+
+	/** Minimum stamina change before a continuous drain or regen broadcasts OnStaminaChanged */
+	UPROPERTY(EditDefaultsOnly, Category = "Stamina|Broadcast", meta = (ClampMin = "0.0"))
+	float BroadcastDeltaThreshold = 1.0f;
+
+#pragma endregion Broadcast
+
 protected:
 
 	virtual void BeginPlay() override;
@@ -120,9 +132,18 @@ protected:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 
+	/** Single update step: regen delay, drain, regen, exhaustion and throttled broadcast */
+	void UpdateStamina(float DeltaTime);
+
+	/** Handle stamina drain logic */
+	void DrainStamina(float DeltaTime);
+
 	/** Handle stamina regeneration logic */
 	void RegenerateStamina(float DeltaTime);
 
+	/** Broadcast OnStaminaChanged; unless forced, only after BroadcastDeltaThreshold of change or at a bound */
+	void BroadcastStaminaChanged(bool bForce);
+
 	/** Check and update exhaustion state */
 	void UpdateExhaustionState();
 
@@ -4,12 +4,21 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "TFStatsSubsystem.h"
+#include "TFTypes.h"
 #include "TFStatsComponent.generated.h"
 
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnStatChanged, float, float);
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnNamedStatChanged, FName, float, float);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnStatDepleted, FName);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnStatCritical, FName, float);
 
+/**
+ * Set of decaying survival stats defined by data.
+ * Defaults come from StatDefinitions and are overridden or extended by StatConfig.ini;
+ * values live in the world's stats subsystem.
+ * StatConfig.ini applies to every owner, NPCs and animals included; clear bUseStatConfig to opt out.
+ */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class COMPONENTS_API UTFStatsComponent : public UActorComponent
 {
@@ -17,89 +26,108 @@ class COMPONENTS_API UTFStatsComponent : public UActorComponent
 
 private:
 
-#pragma region Timer Handles
+	/** Per-stat bookkeeping, parallel to ActiveDefinitions */
+	struct FStatState
+	{
+		int32 Row = INDEX_NONE;
+		bool bIsCritical = false;
+		bool bIsDepleted = false;
 
-	FTimerHandle HungerDecayTimerHandle;
-	FTimerHandle ThirstDecayTimerHandle;
+		/** Analytic decay: fires at the next critical or depletion crossing */
+		FTimerHandle ThresholdTimer;
+	};
 
-#pragma endregion Timer Handles
+#pragma region Stat Store Handle
 
-#pragma region Hunger Values
+	/** Values live in the world's stats subsystem; the component only keeps row indices */
+	TWeakObjectPtr<UTFStatsSubsystem> StatsSubsystem;
 
-	UPROPERTY(VisibleAnywhere, Category = "Stats|Hunger")
-	float CurrentHunger;
+	/** StatDefinitions merged with StatConfig.ini at BeginPlay */
+	TArray<FTFStatDefinition> ActiveDefinitions;
+	TArray<FStatState> StatStates;
 
-	UPROPERTY(EditDefaultsOnly, Category = "Stats|Hunger", meta = (ClampMin = "1.0", ClampMax = "1000.0"))
-	float MaxHunger = 100.0f;
+	friend class UTFStatsSubsystem;
 
-	UPROPERTY(EditDefaultsOnly, Category = "Stats|Hunger", meta = (ClampMin = "0.0"))
-	float HungerDecayAmount = 1.0f;
+	/** Called by the subsystem after a decay pass changed this stat, or by a threshold timer */
+	void HandleStatDecayed(int32 StatIndex);
 
-	UPROPERTY(EditDefaultsOnly, Category = "Stats|Hunger", meta = (ClampMin = "0.1"))
-	float HungerDecayInterval = 5.0f;
+	/** Called by the subsystem when a row is compacted into a new index */
+	void HandleStatRowMoved(int32 StatIndex, int32 NewRow);
 
-	UPROPERTY(EditDefaultsOnly, Category = "Stats|Hunger", meta = (ClampMin = "0.0", ClampMax = "1.0"))
-	float HungerCriticalThreshold = 0.2f;
+	/** Re-arms the stat's threshold timer for the next crossing */
+	void ScheduleThresholdTimer(int32 StatIndex);
 
-#pragma endregion Hunger Values
+	void BroadcastStatChanged(int32 StatIndex);
 
-#pragma region Thirst Values
+	float GetStatValueAt(int32 StatIndex) const;
 
-	UPROPERTY(VisibleAnywhere, Category = "Stats|Thirst")
-	float CurrentThirst;
+	/** Writes the value and raises change events if it moved */
+	void SetStatValueAt(int32 StatIndex, float NewValue);
 
-	UPROPERTY(EditDefaultsOnly, Category = "Stats|Thirst", meta = (ClampMin = "1.0", ClampMax = "1000.0"))
-	float MaxThirst = 100.0f;
+	/** Active definition if registered, otherwise the default; nullptr if unknown */
+	const FTFStatDefinition* FindDefinition(FName StatName) const;
 
-	UPROPERTY(EditDefaultsOnly, Category = "Stats|Thirst", meta = (ClampMin = "0.0"))
-	float ThirstDecayAmount = 1.5f;
+#pragma endregion Stat Store Handle
 
-	UPROPERTY(EditDefaultsOnly, Category = "Stats|Thirst", meta = (ClampMin = "0.1"))
-	float ThirstDecayInterval = 4.0f;
+#pragma region Stat Values
 
-	UPROPERTY(EditDefaultsOnly, Category = "Stats|Thirst", meta = (ClampMin = "0.0", ClampMax = "1.0"))
-	float ThirstCriticalThreshold = 0.2f;
+	/** Stats this component tracks; entries in StatConfig.ini with the same name replace these */
+	UPROPERTY(EditDefaultsOnly, Category = "Stats")
+	TArray<FTFStatDefinition> StatDefinitions;
 
-#pragma endregion Thirst Values
+	/** Merge definitions from StatConfig.ini; stats only listed there are added. Clear for NPCs or animals with their own stat set */
+	UPROPERTY(EditDefaultsOnly, Category = "Stats")
+	bool bUseStatConfig = true;
 
-#pragma region State
+#pragma endregion Stat Values
 
-	UPROPERTY(VisibleAnywhere, Category = "Stats|State")
-	bool bIsHungerCritical = false;
+#if WITH_EDITORONLY_DATA
 
-	UPROPERTY(VisibleAnywhere, Category = "Stats|State")
-	bool bIsThirstCritical = false;
+#pragma region Deprecated Stat Values
 
-	UPROPERTY(VisibleAnywhere, Category = "Stats|State")
-	bool bIsHungerDepleted = false;
+	/** Pre-StatDefinitions fields, folded into StatDefinitions in PostLoad; negative means not saved */
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Use StatDefinitions"))
+	float MaxHunger_DEPRECATED = -1.0f;
 
-	UPROPERTY(VisibleAnywhere, Category = "Stats|State")
-	bool bIsThirstDepleted = false;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Use StatDefinitions"))
+	float HungerDecayAmount_DEPRECATED = -1.0f;
 
-#pragma endregion State
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Use StatDefinitions"))
+	float HungerDecayInterval_DEPRECATED = -1.0f;
 
-protected:
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Use StatDefinitions"))
+	float HungerCriticalThreshold_DEPRECATED = -1.0f;
 
-	virtual void BeginPlay() override;
-	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Use StatDefinitions"))
+	float MaxThirst_DEPRECATED = -1.0f;
 
-	/** Start decay timers */
-	void StartDecayTimers();
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Use StatDefinitions"))
+	float ThirstDecayAmount_DEPRECATED = -1.0f;
 
-	/** Stop decay timers */
-	void StopDecayTimers();
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Use StatDefinitions"))
+	float ThirstDecayInterval_DEPRECATED = -1.0f;
 
-	/** Timer callback for hunger decay */
-	void DecayHunger();
+	UPROPERTY(meta = (DeprecatedProperty, DeprecationMessage = "Use StatDefinitions"))
+	float ThirstCriticalThreshold_DEPRECATED = -1.0f;
 
-	/** Timer callback for thirst decay */
-	void DecayThirst();
+#pragma endregion Deprecated Stat Values
 
-	/** Update hunger critical state */
-	void UpdateHungerCriticalState();
+#endif // WITH_EDITORONLY_DATA
 
-	/** Update thirst critical state */
-	void UpdateThirstCriticalState();
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void PostLoad() override;
+
+	/** Register one row per stat with the stats subsystem */
+	void RegisterStatRows();
+
+	/** Release the rows owned by this component */
+	void UnregisterStatRows();
+
+	/** Update a stat's critical and depleted state and its threshold timer */
+	void UpdateCriticalState(int32 StatIndex);
 
 public:
 
@@ -107,19 +135,55 @@ public:
 
 #pragma region Delegates
 
+	/** Fires for every stat with (StatName, Current, Max) */
+	FOnNamedStatChanged OnStatChanged;
+
+	/** Per-stat adapters over OnStatChanged */
 	FOnStatChanged OnHungerChanged;
 	FOnStatChanged OnThirstChanged;
+
 	FOnStatDepleted OnStatDepleted;
 	FOnStatCritical OnStatCritical;
 
 #pragma endregion Delegates
 
+#pragma region Generic Stats
+
+	/** Index of the stat in this component, or INDEX_NONE */
+	int32 FindStat(FName StatName) const;
+
+	bool HasStat(FName StatName) const { return FindStat(StatName) != INDEX_NONE; }
+
+	float GetStatValue(FName StatName) const;
+	float GetStatMax(FName StatName) const;
+	float GetStatPercent(FName StatName) const;
+	bool IsStatCritical(FName StatName) const;
+	bool IsStatDepleted(FName StatName) const;
+
+	/** Clamps to [0, Max] */
+	void SetStatValue(FName StatName, float NewValue);
+
+	/** Adds Delta, negative to consume */
+	void ModifyStat(FName StatName, float Delta);
+
+	void SetStatMax(FName StatName, float NewMax);
+
+	/** Restarts the stat's decay interval */
+	void SetStatDecayRate(FName StatName, float DecayAmount, float DecayInterval);
+
+	void SetDecayPaused(bool bPaused);
+
+	/** True if values decay on query and change events only fire at thresholds */
+	bool IsAnalyticDecay() const;
+
+#pragma endregion Generic Stats
+
 #pragma region Hunger Functions
 
 	void ConsumeHunger(float Amount);
 	void RestoreHunger(float Amount);
-	void SetHunger(float NewHunger);
-	void FullyRestoreHunger();
+	void SetHunger(float NewHunger) { SetStatValue(TFStatNames::Hunger, NewHunger); }
+	void FullyRestoreHunger() { SetHunger(GetMaxHunger()); }
 
 #pragma endregion Hunger Functions
 
@@ -127,33 +191,32 @@ public:
 
 	void ConsumeThirst(float Amount);
 	void RestoreThirst(float Amount);
-	void SetThirst(float NewThirst);
-	void FullyRestoreThirst();
+	void SetThirst(float NewThirst) { SetStatValue(TFStatNames::Thirst, NewThirst); }
+	void FullyRestoreThirst() { SetThirst(GetMaxThirst()); }
 
 #pragma endregion Thirst Functions
 
 #pragma region Queries
 
-	float GetCurrentHunger() const { return CurrentHunger; }
-	float GetMaxHunger() const { return MaxHunger; }
-	float GetHungerPercent() const;
-	bool IsHungerCritical() const { return bIsHungerCritical; }
-	bool IsHungerDepleted() const { return bIsHungerDepleted; }
-	float GetCurrentThirst() const { return CurrentThirst; }
-	float GetMaxThirst() const { return MaxThirst; }
-	float GetThirstPercent() const;
-	bool IsThirstCritical() const { return bIsThirstCritical; }
-	bool IsThirstDepleted() const { return bIsThirstDepleted; }
+	float GetCurrentHunger() const { return GetStatValue(TFStatNames::Hunger); }
+	float GetMaxHunger() const { return GetStatMax(TFStatNames::Hunger); }
+	float GetHungerPercent() const { return GetStatPercent(TFStatNames::Hunger); }
+	bool IsHungerCritical() const { return IsStatCritical(TFStatNames::Hunger); }
+	bool IsHungerDepleted() const { return IsStatDepleted(TFStatNames::Hunger); }
+	float GetCurrentThirst() const { return GetStatValue(TFStatNames::Thirst); }
+	float GetMaxThirst() const { return GetStatMax(TFStatNames::Thirst); }
+	float GetThirstPercent() const { return GetStatPercent(TFStatNames::Thirst); }
+	bool IsThirstCritical() const { return IsStatCritical(TFStatNames::Thirst); }
+	bool IsThirstDepleted() const { return IsStatDepleted(TFStatNames::Thirst); }
 
 #pragma endregion Queries
 
 #pragma region Configuration
 
-	void SetMaxHunger(float NewMax);
-	void SetHungerDecayRate(float DecayAmount, float DecayInterval);
-	void SetMaxThirst(float NewMax);
-	void SetThirstDecayRate(float DecayAmount, float DecayInterval);
-	void SetDecayPaused(bool bPaused);
+	void SetMaxHunger(float NewMax) { SetStatMax(TFStatNames::Hunger, NewMax); }
+	void SetHungerDecayRate(float DecayAmount, float DecayInterval) { SetStatDecayRate(TFStatNames::Hunger, DecayAmount, DecayInterval); }
+	void SetMaxThirst(float NewMax) { SetStatMax(TFStatNames::Thirst, NewMax); }
+	void SetThirstDecayRate(float DecayAmount, float DecayInterval) { SetStatDecayRate(TFStatNames::Thirst, DecayAmount, DecayInterval); }
 
 #pragma endregion Configuration
 };
@@ -0,0 +1,148 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TFStatsSubsystem.generated.h"
+
+class UTFStatsComponent;
+
+/** One decaying stat: where it starts, how fast it drains and when it turns critical */
+USTRUCT()
+struct COMPONENTS_API FTFStatDefinition
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Stat")
+	FName StatName;
+
+	UPROPERTY(EditAnywhere, Category = "Stat", meta = (ClampMin = "1.0", ClampMax = "1000.0"))
+	float MaxValue = 100.0f;
+
+	/** Starting value; negative starts at MaxValue */
+	UPROPERTY(EditAnywhere, Category = "Stat")
+	float InitialValue = -1.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Stat", meta = (ClampMin = "0.0"))
+	float DecayAmount = 1.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Stat", meta = (ClampMin = "0.1"))
+	float DecayInterval = 5.0f;
+
+	/** Fraction of MaxValue at or below which the stat is critical */
+	UPROPERTY(EditAnywhere, Category = "Stat", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float CriticalThreshold = 0.2f;
+};
+
+/**
+ * Owns the decaying stat values of every UTFStatsComponent in the world.
+ * Values live in contiguous arrays and decay in one batched pass per interval;
+ * owning components are notified once the pass has finished.
+ * In analytic mode no pass runs: values are evaluated from a base value and
+ * timestamp on query, and owners schedule their own threshold timers.
+ */
+UCLASS(Config = Game)
+class COMPONENTS_API UTFStatsSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+
+#pragma region Settings
+
+	/** Seconds between batched decay passes */
+	UPROPERTY(Config)
+	float DecayBatchInterval = 0.25f;
+
+	/** Row count above which the decay pass is split across worker threads */
+	UPROPERTY(Config)
+	int32 ParallelRowThreshold = 1024;
+
+	/** Opt-in: evaluate decay on query instead of stepping every row on the batched timer */
+	UPROPERTY(Config)
+	bool bAnalyticDecay = false;
+
+	/** Stat table read from StatConfig.ini, one entry per section */
+	TArray<FTFStatDefinition> ConfiguredStats;
+
+	void LoadStatConfig();
+
+#pragma endregion Settings
+
+#pragma region Stat Store
+
+	TArray<float> Values;
+	TArray<float> MaxValues;
+	TArray<float> DecayAmounts;
+	TArray<float> DecayIntervals;
+	TArray<float> DecayElapsed;
+
+	/** Analytic mode: world time at which Values[Row] was exact, aligned to a decay step */
+	TArray<double> BaseTimes;
+
+	TArray<uint8> PausedFlags;
+	TArray<uint8> ChangedFlags;
+	/** Index of the row's stat within its owner */
+	TArray<int32> RowStatIndices;
+
+	UPROPERTY()
+	TArray<UTFStatsComponent*> RowOwners;
+
+#pragma endregion Stat Store
+
+	FTimerHandle DecayTimerHandle;
+
+	void RunDecayPass();
+	void DecayRows(int32 FirstRow, int32 EndRow, float DeltaSeconds);
+
+	double GetTime() const;
+
+	/** Decay steps completed since the row's base time */
+	float GetElapsedSteps(int32 Row, double Now) const;
+
+	/** Analytic mode: bakes elapsed decay into the stored value and advances the base time */
+	void FoldRow(int32 Row);
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Stat definitions from StatConfig.ini; components merge these over their defaults */
+	const TArray<FTFStatDefinition>& GetConfiguredStats() const { return ConfiguredStats; }
+
+#pragma region Registration
+
+	/** Adds a stat row owned by Owner and returns its index */
+	int32 RegisterStat(UTFStatsComponent* Owner, int32 StatIndex, float InitialValue, float MaxValue, float DecayAmount, float DecayInterval);
+
+	/** Removes a row; the row currently stored last is moved into its place */
+	void UnregisterStat(int32 Row);
+
+	int32 GetNumRows() const { return Values.Num(); }
+
+#pragma endregion Registration
+
+#pragma region Row Access
+
+	float GetValue(int32 Row) const;
+	float GetMaxValue(int32 Row) const { return MaxValues[Row]; }
+
+	/** Clamps to [0, Max]; returns true if the stored value changed */
+	bool SetValue(int32 Row, float NewValue);
+	void SetMaxValue(int32 Row, float NewMax);
+	void SetDecayRate(int32 Row, float DecayAmount, float DecayInterval);
+	void SetPaused(int32 Row, bool bPaused);
+
+	bool IsAnalyticDecay() const { return bAnalyticDecay; }
+
+	/** Analytic mode: seconds until the row decays to TargetValue or below; negative if it never will */
+	float GetTimeUntilValue(int32 Row, float TargetValue) const;
+
+#pragma endregion Row Access
+};
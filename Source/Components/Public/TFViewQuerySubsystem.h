@@ -0,0 +1,72 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+#include "Subsystems/LocalPlayerSubsystem.h"
+#include "TFViewQuerySubsystem.generated.h"
+
+class APlayerController;
+
+/** Result of the shared view trace for one frame */
+struct FTFViewQueryResult
+{
+	FVector ViewLocation = FVector::ZeroVector;
+	FRotator ViewRotation = FRotator::ZeroRotator;
+
+	/** Length of the trace that produced this result */
+	float TraceDistance = 0.0f;
+
+	bool bHit = false;
+	FHitResult Hit;
+
+	uint64 FrameNumber = 0;
+
+	FVector GetTraceEnd() const { return ViewLocation + ViewRotation.Vector() * TraceDistance; }
+
+	/** True if the trace hit something within Distance of the view point */
+	bool HasHitWithin(float Distance) const { return bHit && Hit.Distance <= Distance; }
+};
+
+/**
+ * Runs at most one view trace per frame per channel for a local player
+ * and shares the result between the crosshair and interaction detection.
+ * The first request of a frame traces only its own distance; a longer request
+ * later in the frame extends a trace that found nothing from where it ended.
+ * Requesters clamp the shared hit to their own distance with HasHitWithin.
+ */
+UCLASS()
+class COMPONENTS_API UTFViewQuerySubsystem : public ULocalPlayerSubsystem
+{
+	GENERATED_BODY()
+
+private:
+
+	struct FQueryKey
+	{
+		ECollisionChannel Channel;
+		bool bTraceComplex;
+
+		bool operator==(const FQueryKey& Other) const { return Channel == Other.Channel && bTraceComplex == Other.bTraceComplex; }
+		friend uint32 GetTypeHash(const FQueryKey& Key) { return HashCombine(::GetTypeHash(static_cast<uint8>(Key.Channel)), ::GetTypeHash(Key.bTraceComplex)); }
+	};
+
+	TMap<FQueryKey, FTFViewQueryResult> Queries;
+
+	/** Traces from StartDistance to Distance along the result's view, which must already be set */
+	void RunQuery(APlayerController* PC, FTFViewQueryResult& Result, const FQueryKey& Key, float StartDistance, float Distance) const;
+
+public:
+
+	virtual void Deinitialize() override;
+
+	static UTFViewQuerySubsystem* Get(const APlayerController* PC);
+
+	/**
+	 * Returns this frame's view trace for the channel, tracing only the part not yet
+	 * covered this frame. The hit may lie beyond Distance; check it with HasHitWithin.
+	 * Returns nullptr if the player has no view.
+	 */
+	const FTFViewQueryResult* QueryView(ECollisionChannel Channel, bool bTraceComplex, float Distance);
+};
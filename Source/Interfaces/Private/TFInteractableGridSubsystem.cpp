@@ -0,0 +1,176 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFInteractableGridSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+void UTFInteractableGridSubsystem::Deinitialize()
+{
+	Cells.Empty();
+	Entries.Empty();
+	MaxRadius = 0.0f;
+
+	Super::Deinitialize();
+}
+
+UTFInteractableGridSubsystem* UTFInteractableGridSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTFInteractableGridSubsystem>() : nullptr;
+}
+
+FIntVector UTFInteractableGridSubsystem::GetCell(const FVector& Location) const
+{
+	const double Size = FMath::Max(1.0f, CellSize);
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / Size),
+		FMath::FloorToInt32(Location.Y / Size),
+		FMath::FloorToInt32(Location.Z / Size)
+	);
+}
+
+void UTFInteractableGridSubsystem::AddToCell(const FIntVector& Cell, AActor* Actor)
+{
+	Cells.FindOrAdd(Cell).Add(Actor);
+}
+
+void UTFInteractableGridSubsystem::RemoveFromCell(const FIntVector& Cell, const AActor* Actor)
+{
+	if (auto* CellActors = Cells.Find(Cell))
+	{
+		CellActors->RemoveAllSwap([Actor](const TWeakObjectPtr<AActor>& Entry)
+		{
+			return !Entry.IsValid() || Entry.Get() == Actor;
+		});
+
+		if (CellActors->IsEmpty())
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void UTFInteractableGridSubsystem::RecomputeMaxRadius()
+{
+	MaxRadius = 0.0f;
+	for (const TPair<TObjectKey<AActor>, FGridEntry>& Pair : Entries)
+	{
+		MaxRadius = FMath::Max(MaxRadius, Pair.Value.Radius);
+	}
+}
+
+#pragma region Registration
+
+void UTFInteractableGridSubsystem::UpdateInteractable(AActor* Actor, const FVector& Origin, float Radius)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	const FIntVector Cell = GetCell(Origin);
+
+	if (FGridEntry* Entry = Entries.Find(Actor))
+	{
+		if (Entry->Cell != Cell)
+		{
+			RemoveFromCell(Entry->Cell, Actor);
+			AddToCell(Cell, Actor);
+		}
+
+		const bool bShrankLargest = Entry->Radius >= MaxRadius && Radius < MaxRadius;
+		*Entry = FGridEntry{Cell, Origin, Radius};
+
+		if (bShrankLargest)
+		{
+			RecomputeMaxRadius();
+		}
+		else
+		{
+			MaxRadius = FMath::Max(MaxRadius, Radius);
+		}
+		return;
+	}
+
+	MaxRadius = FMath::Max(MaxRadius, Radius);
+
+	Entries.Add(Actor, FGridEntry{Cell, Origin, Radius});
+	AddToCell(Cell, Actor);
+}
+
+void UTFInteractableGridSubsystem::UnregisterInteractable(const AActor* Actor)
+{
+	FGridEntry Entry;
+	if (Entries.RemoveAndCopyValue(Actor, Entry))
+	{
+		RemoveFromCell(Entry.Cell, Actor);
+
+		// Keep query reach tight once the largest interactable is gone
+		if (Entry.Radius >= MaxRadius)
+		{
+			RecomputeMaxRadius();
+		}
+	}
+}
+
+#pragma endregion Registration
+
+#pragma region Queries
+
+template <typename FuncType>
+bool UTFInteractableGridSubsystem::ForEachInteractableNear(const FVector& Location, float Radius, FuncType Func) const
+{
+	if (Entries.IsEmpty())
+	{
+		return false;
+	}
+
+	const FVector Reach(Radius + MaxRadius);
+	const FIntVector MinCell = GetCell(Location - Reach);
+	const FIntVector MaxCell = GetCell(Location + Reach);
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				const auto* CellActors = Cells.Find(FIntVector(X, Y, Z));
+				if (!CellActors)
+				{
+					continue;
+				}
+
+				for (const TWeakObjectPtr<AActor>& Actor : *CellActors)
+				{
+					const FGridEntry* Entry = Entries.Find(Actor.Get());
+					if (Entry && FVector::DistSquared(Location, Entry->Origin) <= FMath::Square(Radius + Entry->Radius) && !Func(Actor.Get()))
+					{
+						return true;
+					}
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+bool UTFInteractableGridSubsystem::HasInteractableNear(const FVector& Location, float Radius) const
+{
+	// Stop at the first match
+	return ForEachInteractableNear(Location, Radius, [](AActor*) { return false; });
+}
+
+void UTFInteractableGridSubsystem::GetInteractablesNear(const FVector& Location, float Radius, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset();
+
+	ForEachInteractableNear(Location, Radius, [&OutActors](AActor* Actor)
+	{
+		OutActors.Add(Actor);
+		return true;
+	});
+}
+
+#pragma endregion Queries
@@ -1,3 +1,44 @@
 #include "TFPickupableInterface.h"
+#include "UObject/Package.h"
+#include "UObject/PropertyTag.h"
 
+bool FItemDefinition::IsEquivalent(const FItemDefinition& Other) const
+{
+	return ItemID == Other.ItemID
+		&& ItemType == Other.ItemType
+		&& ItemName.EqualTo(Other.ItemName)
+		&& ItemDescription.EqualTo(Other.ItemDescription)
+		&& Weight == Other.Weight
+		&& HungerRestore == Other.HungerRestore
+		&& ThirstRestore == Other.ThirstRestore
+		&& BackpackSlots == Other.BackpackSlots
+		&& BackpackWeightLimit == Other.BackpackWeightLimit
+		&& ItemMesh == Other.ItemMesh
+		&& ItemMeshScale.Equals(Other.ItemMeshScale)
+		&& MaxInteractionDistance == Other.MaxInteractionDistance;
+}
 
+bool FItemDefinition::SerializeFromMismatchedTag(const FPropertyTag& Tag, FStructuredArchive::FSlot Slot)
+{
+	// The old FItemData reaches here through the ItemData -> ItemDefinition property redirect; its fields match by name
+	if (Tag.Type != NAME_StructProperty)
+	{
+		return false;
+	}
+
+	StaticStruct()->SerializeItem(Slot, this, nullptr);
+	return true;
+}
+
+UTFItemDefinition* UTFItemDefinition::Create(const FItemDefinition& InDefinition, UObject* Outer)
+{
+	UTFItemDefinition* NewDefinition = NewObject<UTFItemDefinition>(Outer ? Outer : GetTransientPackage());
+	NewDefinition->Definition = InDefinition;
+	return NewDefinition;
+}
+
+const FItemDefinition& FItemData::GetDefinition() const
+{
+	static const FItemDefinition DefaultDefinition;
+	return Definition ? Definition->Get() : DefaultDefinition;
+}
@@ -0,0 +1,33 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFStats.h"
+
+DEFINE_STAT(STAT_TFInteractionCheck);
+DEFINE_STAT(STAT_TFCrosshairTick);
+DEFINE_STAT(STAT_TFDayNightUpdate);
+DEFINE_STAT(STAT_TFStaminaUpdate);
+DEFINE_STAT(STAT_TFStatDecay);
+DEFINE_STAT(STAT_TFDoorAnimation);
+DEFINE_STAT(STAT_TFConfigLoad);
+
+DEFINE_STAT(STAT_TFInteractionChecks);
+DEFINE_STAT(STAT_TFStaminaUpdates);
+DEFINE_STAT(STAT_TFStatRowsDecayed);
+DEFINE_STAT(STAT_TFDoorsAnimated);
+DEFINE_STAT(STAT_TFConfigEntries);
+
+DEFINE_STAT(STAT_TFViewQueryRequests);
+DEFINE_STAT(STAT_TFViewQueryTraces);
+
+DEFINE_STAT(STAT_TFPickupsTracked);
+DEFINE_STAT(STAT_TFPickupsSimulating);
+DEFINE_STAT(STAT_TFPickupsFrozen);
+DEFINE_STAT(STAT_TFPickupFreezes);
+DEFINE_STAT(STAT_TFPickupThaws);
+
+DEFINE_STAT(STAT_TFPickupsInstanced);
+DEFINE_STAT(STAT_TFPickupClusters);
+
+UE_TRACE_CHANNEL_DEFINE(TFChannel);
+
+CSV_DEFINE_CATEGORY_MODULE(INTERFACES_API, TF, true);
@@ -10,5 +10,6 @@ DEFINE_LOG_CATEGORY(LogTFItem);
 DEFINE_LOG_CATEGORY(LogTFCharacter);
 DEFINE_LOG_CATEGORY(LogTFStats);
 DEFINE_LOG_CATEGORY(LogTFContainer);
+DEFINE_LOG_CATEGORY(LogTFConfig);
 
 ITFContainerInterface* FTFContainerContext::ActiveContainer = nullptr;
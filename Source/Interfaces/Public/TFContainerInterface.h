@@ -28,6 +28,13 @@ public:
 	virtual bool ContainerHasSpace() const = 0;
 	virtual bool AddItemToContainer(const FItemData& Item) = 0;
 	virtual bool RemoveItemFromContainer(FName ItemID) = 0;
+
+	/** Adds every item or none if they do not all fit; one change notification */
+	virtual bool AddItemsToContainer(TConstArrayView<FItemData> NewItems) = 0;
+
+	/** Removes the items at Indices, appending them to OutRemoved; one change notification */
+	virtual int32 RemoveContainerItemsAt(TConstArrayView<int32> Indices, TArray<FItemData>& OutRemoved) = 0;
+
 	virtual const FItemData* GetContainerItem(FName ItemID) const = 0;
 	virtual FText GetContainerName() const = 0;
 	virtual void CloseContainer() = 0;
@@ -0,0 +1,72 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TFInteractableGridSubsystem.generated.h"
+
+/**
+ * Uniform grid of interactable actors, keyed by bounds origin.
+ * Lets detection skip scene queries when nothing interactable is nearby.
+ */
+UCLASS(Config = Game)
+class INTERFACES_API UTFInteractableGridSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+
+	struct FGridEntry
+	{
+		FIntVector Cell;
+		FVector Origin;
+		float Radius;
+	};
+
+	/** Edge length of a grid cell; matches the interaction distance clamp */
+	UPROPERTY(Config)
+	float CellSize = 1000.0f;
+
+	TMap<FIntVector, TArray<TWeakObjectPtr<AActor>, TInlineAllocator<4>>> Cells;
+	TMap<TObjectKey<AActor>, FGridEntry> Entries;
+
+	/** Largest registered bounds radius, added to every query */
+	float MaxRadius = 0.0f;
+
+	/** Rescans Entries; only needed once the entry holding MaxRadius shrinks or leaves */
+	void RecomputeMaxRadius();
+
+	FIntVector GetCell(const FVector& Location) const;
+	void AddToCell(const FIntVector& Cell, AActor* Actor);
+	void RemoveFromCell(const FIntVector& Cell, const AActor* Actor);
+
+	/** Calls Func for each interactable in range until it returns false; returns true if stopped early */
+	template <typename FuncType>
+	bool ForEachInteractableNear(const FVector& Location, float Radius, FuncType Func) const;
+
+public:
+
+	virtual void Deinitialize() override;
+
+	static UTFInteractableGridSubsystem* Get(const UObject* WorldContextObject);
+
+#pragma region Registration
+
+	/** Adds the actor, or moves it if it is already registered */
+	void UpdateInteractable(AActor* Actor, const FVector& Origin, float Radius);
+	void UnregisterInteractable(const AActor* Actor);
+
+	int32 GetNumInteractables() const { return Entries.Num(); }
+
+#pragma endregion Registration
+
+#pragma region Queries
+
+	/** True if any registered interactable's bounds may reach within Radius of Location */
+	bool HasInteractableNear(const FVector& Location, float Radius) const;
+
+	void GetInteractablesNear(const FVector& Location, float Radius, TArray<AActor*>& OutActors) const;
+
+#pragma endregion Queries
+};
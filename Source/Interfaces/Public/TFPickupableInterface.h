@@ -19,8 +19,9 @@ enum class EItemType : uint8
 	Backpack    UMETA(DisplayName = "Backpack")
 };
 
+/** Data shared by every instance of an item; never mutated once wrapped in a UTFItemDefinition */
 USTRUCT()
-struct FItemData
+struct INTERFACES_API FItemDefinition
 {
 	GENERATED_BODY()
 
@@ -51,8 +52,9 @@ struct FItemData
 	UPROPERTY(EditAnywhere, Category = "Item|Backpack")
 	float BackpackWeightLimit = 25.0f;
 
+	/** Streamed on demand; see UTFItemAssetSubsystem */
 	UPROPERTY()
-	UStaticMesh* ItemMesh = nullptr;
+	TSoftObjectPtr<UStaticMesh> ItemMesh;
 
 	UPROPERTY()
 	FVector ItemMeshScale = FVector::OneVector;
@@ -60,7 +62,7 @@ struct FItemData
 	UPROPERTY()
 	float MaxInteractionDistance = 500.0f;
 
-	FItemData()
+	FItemDefinition()
 		: ItemID(NAME_None)
 		, ItemType(EItemType::Food)
 		, ItemName(FText::FromString("Item"))
@@ -70,11 +72,68 @@ struct FItemData
 		, ThirstRestore(0.0f)
 		, BackpackSlots(5)
 		, BackpackWeightLimit(25.0f)
-		, ItemMesh(nullptr)
 		, ItemMeshScale(FVector::OneVector)
 		, MaxInteractionDistance(500.0f)
 	{
 	}
+
+	bool IsEquivalent(const FItemDefinition& Other) const;
+
+	/** Loads pickups saved before the split, whose ItemData property held these same fields inline */
+	bool SerializeFromMismatchedTag(const FPropertyTag& Tag, FStructuredArchive::FSlot Slot);
+};
+
+template<>
+struct TStructOpsTypeTraits<FItemDefinition> : public TStructOpsTypeTraitsBase2<FItemDefinition>
+{
+	enum
+	{
+		WithStructuredSerializeFromMismatchedTag = true,
+	};
+};
+
+/** Immutable, GC-tracked owner of an FItemDefinition that item instances point to */
+UCLASS()
+class INTERFACES_API UTFItemDefinition : public UObject
+{
+	GENERATED_BODY()
+
+private:
+
+	UPROPERTY()
+	FItemDefinition Definition;
+
+public:
+
+	static UTFItemDefinition* Create(const FItemDefinition& InDefinition, UObject* Outer = nullptr);
+
+	const FItemDefinition& Get() const { return Definition; }
+};
+
+/** Per-instance item record. Cheap to copy; shared fields live on the definition. */
+USTRUCT()
+struct INTERFACES_API FItemData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "Item")
+	FName ItemID = NAME_None;
+
+	UPROPERTY(VisibleAnywhere, Category = "Item")
+	const UTFItemDefinition* Definition = nullptr;
+
+	FItemData() = default;
+
+	explicit FItemData(const UTFItemDefinition* InDefinition)
+		: ItemID(InDefinition ? InDefinition->Get().ItemID : NAME_None)
+		, Definition(InDefinition)
+	{
+	}
+
+	bool IsValid() const { return Definition != nullptr; }
+
+	/** Shared definition, or a default one when the instance is empty */
+	const FItemDefinition& GetDefinition() const;
 };
 
 UINTERFACE(MinimalAPI)
@@ -0,0 +1,53 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Trace/Trace.h"
+
+/**
+ * Shared profiling hooks for TF gameplay hot paths.
+ * `stat TF` shows the cycle and item counters; the TF trace channel
+ * (-trace=cpu,TF) and the TF CSV category record the same scopes.
+ */
+
+DECLARE_STATS_GROUP(TEXT("TF"), STATGROUP_TF, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Interaction Check"), STAT_TFInteractionCheck, STATGROUP_TF, INTERFACES_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Crosshair Tick"), STAT_TFCrosshairTick, STATGROUP_TF, INTERFACES_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Day Night Update"), STAT_TFDayNightUpdate, STATGROUP_TF, INTERFACES_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Stamina Update"), STAT_TFStaminaUpdate, STATGROUP_TF, INTERFACES_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Stat Decay"), STAT_TFStatDecay, STATGROUP_TF, INTERFACES_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Door Animation"), STAT_TFDoorAnimation, STATGROUP_TF, INTERFACES_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Config Load"), STAT_TFConfigLoad, STATGROUP_TF, INTERFACES_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Interaction Checks"), STAT_TFInteractionChecks, STATGROUP_TF, INTERFACES_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Stamina Updates"), STAT_TFStaminaUpdates, STATGROUP_TF, INTERFACES_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Stat Rows Decayed"), STAT_TFStatRowsDecayed, STATGROUP_TF, INTERFACES_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Doors Animated"), STAT_TFDoorsAnimated, STATGROUP_TF, INTERFACES_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Config Entries"), STAT_TFConfigEntries, STATGROUP_TF, INTERFACES_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("View Query Requests"), STAT_TFViewQueryRequests, STATGROUP_TF, INTERFACES_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("View Query Traces"), STAT_TFViewQueryTraces, STATGROUP_TF, INTERFACES_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Tracked Pickups"), STAT_TFPickupsTracked, STATGROUP_TF, INTERFACES_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Simulating Bodies"), STAT_TFPickupsSimulating, STATGROUP_TF, INTERFACES_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Frozen Bodies"), STAT_TFPickupsFrozen, STATGROUP_TF, INTERFACES_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Freezes"), STAT_TFPickupFreezes, STATGROUP_TF, INTERFACES_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Thaws"), STAT_TFPickupThaws, STATGROUP_TF, INTERFACES_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Instanced Pickups"), STAT_TFPickupsInstanced, STATGROUP_TF, INTERFACES_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Instance Clusters"), STAT_TFPickupClusters, STATGROUP_TF, INTERFACES_API);
+
+UE_TRACE_CHANNEL_EXTERN(TFChannel, INTERFACES_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(INTERFACES_API, TF);
+
+/** Times the enclosing scope as STAT_TF<Name>, a TF trace event and a TF CSV timing stat */
+#define TF_SCOPE_CYCLE_COUNTER(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_TF##Name); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("TF::" #Name, TFChannel); \
+	CSV_SCOPED_TIMING_STAT(TF, Name)
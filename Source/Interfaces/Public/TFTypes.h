@@ -4,14 +4,52 @@
 
 #include "CoreMinimal.h"
 #include "InterfacesModule.h"
+#include "Logging/StructuredLog.h"
 #include "Misc/ConfigCacheIni.h"
+#include "UObject/SoftObjectPtr.h"
 
-INTERFACES_API DECLARE_LOG_CATEGORY_EXTERN(LogTFInteraction, Log, All);
-INTERFACES_API DECLARE_LOG_CATEGORY_EXTERN(LogTFDoor, Log, All);
-INTERFACES_API DECLARE_LOG_CATEGORY_EXTERN(LogTFItem, Log, All);
-INTERFACES_API DECLARE_LOG_CATEGORY_EXTERN(LogTFCharacter, Log, All);
-INTERFACES_API DECLARE_LOG_CATEGORY_EXTERN(LogTFStats, Log, All);
-INTERFACES_API DECLARE_LOG_CATEGORY_EXTERN(LogTFContainer, Log, All);
+/**
+ * Compile-time verbosity caps for the TF log categories. Messages above the cap are
+ * compiled out, arguments included. Shipping and Test keep warnings and errors only;
+ * override globally or per category through module or target definitions.
+ */
+#ifndef TF_LOG_COMPILE_VERBOSITY
+	#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+		#define TF_LOG_COMPILE_VERBOSITY Warning
+	#else
+		#define TF_LOG_COMPILE_VERBOSITY All
+	#endif
+#endif
+
+#ifndef TF_INTERACTION_LOG_COMPILE_VERBOSITY
+	#define TF_INTERACTION_LOG_COMPILE_VERBOSITY TF_LOG_COMPILE_VERBOSITY
+#endif
+#ifndef TF_DOOR_LOG_COMPILE_VERBOSITY
+	#define TF_DOOR_LOG_COMPILE_VERBOSITY TF_LOG_COMPILE_VERBOSITY
+#endif
+#ifndef TF_ITEM_LOG_COMPILE_VERBOSITY
+	#define TF_ITEM_LOG_COMPILE_VERBOSITY TF_LOG_COMPILE_VERBOSITY
+#endif
+#ifndef TF_CHARACTER_LOG_COMPILE_VERBOSITY
+	#define TF_CHARACTER_LOG_COMPILE_VERBOSITY TF_LOG_COMPILE_VERBOSITY
+#endif
+#ifndef TF_STATS_LOG_COMPILE_VERBOSITY
+	#define TF_STATS_LOG_COMPILE_VERBOSITY TF_LOG_COMPILE_VERBOSITY
+#endif
+#ifndef TF_CONTAINER_LOG_COMPILE_VERBOSITY
+	#define TF_CONTAINER_LOG_COMPILE_VERBOSITY TF_LOG_COMPILE_VERBOSITY
+#endif
+#ifndef TF_CONFIG_LOG_COMPILE_VERBOSITY
+	#define TF_CONFIG_LOG_COMPILE_VERBOSITY TF_LOG_COMPILE_VERBOSITY
+#endif
+
+INTERFACES_API DECLARE_LOG_CATEGORY_EXTERN(LogTFInteraction, Log, TF_INTERACTION_LOG_COMPILE_VERBOSITY);
+INTERFACES_API DECLARE_LOG_CATEGORY_EXTERN(LogTFDoor, Log, TF_DOOR_LOG_COMPILE_VERBOSITY);
+INTERFACES_API DECLARE_LOG_CATEGORY_EXTERN(LogTFItem, Log, TF_ITEM_LOG_COMPILE_VERBOSITY);
+INTERFACES_API DECLARE_LOG_CATEGORY_EXTERN(LogTFCharacter, Log, TF_CHARACTER_LOG_COMPILE_VERBOSITY);
+INTERFACES_API DECLARE_LOG_CATEGORY_EXTERN(LogTFStats, Log, TF_STATS_LOG_COMPILE_VERBOSITY);
+INTERFACES_API DECLARE_LOG_CATEGORY_EXTERN(LogTFContainer, Log, TF_CONTAINER_LOG_COMPILE_VERBOSITY);
+INTERFACES_API DECLARE_LOG_CATEGORY_EXTERN(LogTFConfig, Log, TF_CONFIG_LOG_COMPILE_VERBOSITY);
 
 namespace TFStatNames
 {
@@ -22,11 +60,32 @@ namespace TFStatNames
 
 namespace TFConfigUtils
 {
-	
+	inline FString GetConfigFilePath(const FString& FileName)
+	{
+		FString ConfigFilePath = FPaths::ConvertRelativePathToFull(FPaths::ProjectConfigDir() / FileName);
+		FConfigCacheIni::NormalizeConfigIniPath(ConfigFilePath);
+		return ConfigFilePath;
+	}
+
+	inline bool GetINISectionNames(const FString& FileName, TArray<FString>& OutSectionNames, FString& OutConfigFilePath, const FLogCategoryBase& LogCategory, bool bSilentOnMissing = false)
+	{
+		OutConfigFilePath = GetConfigFilePath(FileName);
+
+		if (!FPaths::FileExists(OutConfigFilePath))
+		{
+			if (!bSilentOnMissing)
+			{
+				UE_LOG_REF(LogCategory, Warning, TEXT("TFConfigUtils: %s not found at %s"), *FileName, *OutConfigFilePath);
+			}
+			return false;
+		}
+
+		return GConfig->GetSectionNames(OutConfigFilePath, OutSectionNames);
+	}
+
 	inline bool LoadINISection(const FString& FileName, const FString& SectionName, FString& OutConfigFilePath, const FLogCategoryBase& LogCategory, bool bSilentOnMissing = false)
 	{
-		OutConfigFilePath = FPaths::ConvertRelativePathToFull(FPaths::ProjectConfigDir() / FileName);
-		FConfigCacheIni::NormalizeConfigIniPath(OutConfigFilePath);
+		OutConfigFilePath = GetConfigFilePath(FileName);
 
 		if (!FPaths::FileExists(OutConfigFilePath))
 		{
@@ -67,18 +126,20 @@ namespace TFConfigUtils
 		return DefaultValue;
 	}
 
+	/** Reads an asset path without loading it; null if the key is missing or malformed */
 	template<typename T>
-	T* LoadAssetFromConfig(const FString& SectionName, const TCHAR* Key, const FString& ConfigFilePath, const FLogCategoryBase& LogCategory, const TCHAR* AssetTypeName)
+	TSoftObjectPtr<T> GetSoftAssetFromConfig(const FString& SectionName, const TCHAR* Key, const FString& ConfigFilePath, const FLogCategoryBase& LogCategory, const TCHAR* AssetTypeName)
 	{
 		FString StringValue;
 		if (GConfig->GetString(*SectionName, Key, StringValue, ConfigFilePath) && !StringValue.IsEmpty())
 		{
-			if (T* LoadedAsset = LoadObject<T>(nullptr, *StringValue))
+			const FSoftObjectPath AssetPath(StringValue);
+			if (AssetPath.IsValid())
 			{
-				return LoadedAsset;
+				return TSoftObjectPtr<T>(AssetPath);
 			}
-			UE_LOG_REF(LogCategory, Warning, TEXT("TFConfigUtils: Failed to load %s: %s"), AssetTypeName, *StringValue);
+			UE_LOG_REF(LogCategory, Warning, TEXT("TFConfigUtils: Invalid %s path: %s"), AssetTypeName, *StringValue);
 		}
-		return nullptr;
+		return TSoftObjectPtr<T>();
 	}
 }
@@ -1,7 +1,9 @@
 // Copyright TF Project. All Rights Reserved.
 
 #include "TFInventoryComponent.h"
+#include "TFContainerInterface.h"
 #include "TFTypes.h"
+#include "Algo/Reverse.h"
 
 UTFInventoryComponent::UTFInventoryComponent()
 {
@@ -36,7 +38,19 @@ bool UTFInventoryComponent::ActivateBackpack(int32 Slots, float WeightLimit)
 
 TArray<FItemData> UTFInventoryComponent::DeactivateBackpack()
 {
-	TArray<FItemData> RemovedItems = MoveTemp(Items);
+	// Hand items back oldest first so a later RestoreItems keeps their order
+	TArray<FInventoryItemHandle> OrderedHandles;
+	GetHandlesInAddOrder(OrderedHandles);
+
+	TArray<FItemData> RemovedItems;
+	RemovedItems.Reserve(OrderedHandles.Num());
+	for (const FInventoryItemHandle Handle : OrderedHandles)
+	{
+		RemovedItems.Add(MoveTemp(Items[ItemSlots[Handle.SlotIndex].DenseIndex]));
+	}
+
+	Items.Reset();
+	ResetItemIndex();
 	CurrentWeight = 0.0f;
 
 	int32 OldSlots = BackpackSlots;
@@ -62,30 +76,36 @@ void UTFInventoryComponent::RestoreItems(const TArray<FItemData>& ItemsToRestore
 	}
 
 	int32 RestoredCount = 0;
+	int32 OverweightCount = 0;
 
 	for (const FItemData& Item : ItemsToRestore)
 	{
 		if (Items.Num() >= BackpackSlots)
 		{
-			UE_LOG(LogTFItem, Warning, TEXT("UTFInventoryComponent: Cannot restore item '%s' - no slots available"), *Item.ItemName.ToString());
 			break;
 		}
 
-		if ((CurrentWeight + Item.Weight) > BackpackWeightLimit)
+		if ((CurrentWeight + Item.GetDefinition().Weight) > BackpackWeightLimit)
 		{
-			UE_LOG(LogTFItem, Warning, TEXT("UTFInventoryComponent: Cannot restore item '%s' - weight limit exceeded"), *Item.ItemName.ToString());
+			++OverweightCount;
 			continue;
 		}
 
-		Items.Add(Item);
-		CurrentWeight += Item.Weight;
+		AddItemInternal(Item);
 		OnItemAdded.Broadcast(Item);
 		++RestoredCount;
 	}
 
 	OnInventoryChanged.Broadcast(CurrentWeight, BackpackWeightLimit);
 
-	UE_LOG(LogTFItem, Log, TEXT("UTFInventoryComponent: Restored %d/%d items (Weight: %.1f)"), RestoredCount, ItemsToRestore.Num(), CurrentWeight);
+	// One summary instead of a line per skipped item
+	if (RestoredCount < ItemsToRestore.Num())
+	{
+		UE_LOGFMT(LogTFItem, Warning, "UTFInventoryComponent: Could not restore {Skipped} items ({Overweight} over weight limit, rest out of slots)",
+			ItemsToRestore.Num() - RestoredCount, OverweightCount);
+	}
+
+	UE_LOGFMT(LogTFItem, Log, "UTFInventoryComponent: Restored {Restored}/{Total} items (Weight: {Weight})", RestoredCount, ItemsToRestore.Num(), CurrentWeight);
 }
 
 bool UTFInventoryComponent::AddItem(const FItemData& Item)
@@ -109,16 +129,14 @@ bool UTFInventoryComponent::AddItem(const FItemData& Item)
 			Reason = FText::FromString("Item too heavy");
 		}
 
-		UE_LOG(LogTFItem, Warning, TEXT("UTFInventoryComponent: Cannot add item - %s"), *Reason.ToString());
+		UE_LOGFMT(LogTFItem, Warning, "UTFInventoryComponent: Cannot add item '{ItemID}' - {Reason}", Item.ItemID, Reason);
 		OnInventoryFull.Broadcast(Reason);
 		return false;
 	}
 
-	Items.Add(Item);
-	CurrentWeight += Item.Weight;
+	AddItemInternal(Item);
 
-	UE_LOG(LogTFItem, Log, TEXT("UTFInventoryComponent: Added item '%s' (%.1f kg)"),
-		*Item.ItemName.ToString(), Item.Weight);
+	UE_LOGFMT(LogTFItem, Verbose, "UTFInventoryComponent: Added item '{ItemID}' ({Weight} kg)", Item.ItemID, Item.GetDefinition().Weight);
 
 	OnItemAdded.Broadcast(Item);
 	OnInventoryChanged.Broadcast(CurrentWeight, BackpackWeightLimit);
@@ -133,23 +151,19 @@ bool UTFInventoryComponent::RemoveItem(FName ItemID)
 		return false;
 	}
 
-	for (int32 i = Items.Num() - 1; i >= 0; --i)
+	const FInventoryItemBucket* Bucket = ItemIndex.Find(ItemID);
+	if (!Bucket)
 	{
-		if (Items[i].ItemID == ItemID)
-		{
-			float WeightRemoved = Items[i].Weight;
-			Items.RemoveAt(i);
-			CurrentWeight = FMath::Max(0.0f, CurrentWeight - WeightRemoved);
+		return false;
+	}
 
-			UE_LOG(LogTFItem, Log, TEXT("UTFInventoryComponent: Removed item '%s'"), *ItemID.ToString());
+	RemoveItemAt(ItemSlots[Bucket->NewestSlot].DenseIndex);
 
-			OnItemRemoved.Broadcast(ItemID);
-			OnInventoryChanged.Broadcast(CurrentWeight, BackpackWeightLimit);
-			return true;
-		}
-	}
+	UE_LOGFMT(LogTFItem, Verbose, "UTFInventoryComponent: Removed item '{ItemID}'", ItemID);
 
-	return false;
+	OnItemRemoved.Broadcast(ItemID);
+	OnInventoryChanged.Broadcast(CurrentWeight, BackpackWeightLimit);
+	return true;
 }
 
 bool UTFInventoryComponent::HasItem(FName ItemID) const
@@ -159,26 +173,379 @@ bool UTFInventoryComponent::HasItem(FName ItemID) const
 		return false;
 	}
 
-	for (const FItemData& Item : Items)
+	return ItemIndex.Contains(ItemID);
+}
+
+const FItemData* UTFInventoryComponent::GetItem(FName ItemID) const
+{
+	const FInventoryItemBucket* Bucket = ItemIndex.Find(ItemID);
+	return Bucket ? &Items[ItemSlots[Bucket->OldestSlot].DenseIndex] : nullptr;
+}
+
+int32 UTFInventoryComponent::GetItemCount(FName ItemID) const
+{
+	const FInventoryItemBucket* Bucket = ItemIndex.Find(ItemID);
+	return Bucket ? Bucket->Num : 0;
+}
+
+FInventoryItemHandle UTFInventoryComponent::FindItemHandle(FName ItemID) const
+{
+	const FInventoryItemBucket* Bucket = ItemIndex.Find(ItemID);
+	return Bucket ? FInventoryItemHandle(Bucket->OldestSlot, ItemSlots[Bucket->OldestSlot].Generation) : FInventoryItemHandle();
+}
+
+FInventoryItemHandle UTFInventoryComponent::GetHandleAt(int32 ArrayIndex) const
+{
+	if (!DenseToSlot.IsValidIndex(ArrayIndex))
+	{
+		return FInventoryItemHandle();
+	}
+
+	const int32 SlotIndex = DenseToSlot[ArrayIndex];
+	return FInventoryItemHandle(SlotIndex, ItemSlots[SlotIndex].Generation);
+}
+
+bool UTFInventoryComponent::IsValidHandle(FInventoryItemHandle Handle) const
+{
+	return ItemSlots.IsValidIndex(Handle.SlotIndex)
+		&& ItemSlots[Handle.SlotIndex].Generation == Handle.Generation
+		&& ItemSlots[Handle.SlotIndex].DenseIndex != INDEX_NONE;
+}
+
+const FItemData* UTFInventoryComponent::GetItemByHandle(FInventoryItemHandle Handle) const
+{
+	return IsValidHandle(Handle) ? &Items[ItemSlots[Handle.SlotIndex].DenseIndex] : nullptr;
+}
+
+bool UTFInventoryComponent::RemoveItemByHandle(FInventoryItemHandle Handle)
+{
+	if (!IsValidHandle(Handle))
+	{
+		return false;
+	}
+
+	const FName ItemID = Items[ItemSlots[Handle.SlotIndex].DenseIndex].ItemID;
+	RemoveItemAt(ItemSlots[Handle.SlotIndex].DenseIndex);
+
+	UE_LOGFMT(LogTFItem, Verbose, "UTFInventoryComponent: Removed item '{ItemID}'", ItemID);
+
+	OnItemRemoved.Broadcast(ItemID);
+	OnInventoryChanged.Broadcast(CurrentWeight, BackpackWeightLimit);
+	return true;
+}
+
+void UTFInventoryComponent::GetHandlesInAddOrder(TArray<FInventoryItemHandle>& OutHandles) const
+{
+	OutHandles.Reset(Items.Num());
+	for (int32 SlotIndex = OldestSlot; SlotIndex != INDEX_NONE; SlotIndex = ItemSlots[SlotIndex].NextAdded)
+	{
+		OutHandles.Emplace(SlotIndex, ItemSlots[SlotIndex].Generation);
+	}
+}
+
+void UTFInventoryComponent::GetNewestHandles(int32 Count, TArray<FInventoryItemHandle>& OutHandles) const
+{
+	OutHandles.Reset(FMath::Min(Count, Items.Num()));
+	for (int32 SlotIndex = NewestSlot; SlotIndex != INDEX_NONE && OutHandles.Num() < Count; SlotIndex = ItemSlots[SlotIndex].PrevAdded)
+	{
+		OutHandles.Emplace(SlotIndex, ItemSlots[SlotIndex].Generation);
+	}
+	Algo::Reverse(OutHandles);
+}
+
+bool UTFInventoryComponent::TakeFromContainer(ITFContainerInterface& Container, TConstArrayView<FName> ItemIDs)
+{
+	if (!bHasBackpack)
+	{
+		UE_LOG(LogTFItem, Warning, TEXT("UTFInventoryComponent: Cannot take items - no backpack"));
+		OnInventoryFull.Broadcast(FText::FromString("No backpack equipped"));
+		return false;
+	}
+
+	const TArray<FItemData>& ContainerItems = Container.GetContainerItems();
+
+	// Resolve the selection to container indices and total its weight before anything moves
+	TArray<int32, TInlineAllocator<16>> Indices;
+	float AddedWeight = 0.0f;
+
+	if (ItemIDs.IsEmpty())
+	{
+		Indices.Reserve(ContainerItems.Num());
+		for (int32 Index = 0; Index < ContainerItems.Num(); ++Index)
+		{
+			Indices.Add(Index);
+			AddedWeight += ContainerItems[Index].GetDefinition().Weight;
+		}
+	}
+	else
+	{
+		TBitArray<> Selected(false, ContainerItems.Num());
+		Indices.Reserve(ItemIDs.Num());
+
+		for (const FName ItemID : ItemIDs)
+		{
+			// Newest instance first, matching RemoveItemFromContainer
+			int32 Found = INDEX_NONE;
+			for (int32 Index = ContainerItems.Num() - 1; Index >= 0; --Index)
+			{
+				if (!Selected[Index] && ContainerItems[Index].ItemID == ItemID)
+				{
+					Found = Index;
+					break;
+				}
+			}
+
+			if (Found == INDEX_NONE)
+			{
+				UE_LOGFMT(LogTFItem, Warning, "UTFInventoryComponent: Cannot take items - '{ItemID}' not in container", ItemID);
+				return false;
+			}
+
+			Selected[Found] = true;
+			Indices.Add(Found);
+			AddedWeight += ContainerItems[Found].GetDefinition().Weight;
+		}
+	}
+
+	if (Indices.IsEmpty())
+	{
+		return false;
+	}
+
+	if (Indices.Num() > GetFreeSlots() || !CanCarryWeight(AddedWeight))
+	{
+		const FText Reason = Indices.Num() > GetFreeSlots()
+			? FText::FromString("Inventory full - no slots available")
+			: FText::FromString("Items too heavy");
+
+		UE_LOGFMT(LogTFItem, Warning, "UTFInventoryComponent: Cannot take {Count} items ({Weight} kg) - {Reason}", Indices.Num(), AddedWeight, Reason);
+		OnInventoryFull.Broadcast(Reason);
+		return false;
+	}
+
+	FTFItemDelta Delta;
+	Delta.Added.Reserve(Indices.Num());
+	Container.RemoveContainerItemsAt(Indices, Delta.Added);
+
+	Items.Reserve(Items.Num() + Delta.Added.Num());
+	DenseToSlot.Reserve(DenseToSlot.Num() + Delta.Added.Num());
+	for (const FItemData& Item : Delta.Added)
+	{
+		AddItemInternal(Item);
+	}
+
+	UE_LOGFMT(LogTFItem, Verbose, "UTFInventoryComponent: Took {Count} items from container (Weight: {Weight})", Delta.Added.Num(), CurrentWeight);
+
+	BroadcastItemsChanged(Delta);
+	return true;
+}
+
+bool UTFInventoryComponent::DepositToContainer(ITFContainerInterface& Container, TConstArrayView<FName> ItemIDs)
+{
+	TArray<int32, TInlineAllocator<16>> DenseIndices;
+
+	if (ItemIDs.IsEmpty())
 	{
-		if (Item.ItemID == ItemID)
+		DenseIndices.Reserve(Items.Num());
+		for (int32 Index = 0; Index < Items.Num(); ++Index)
 		{
-			return true;
+			DenseIndices.Add(Index);
 		}
 	}
-	return false;
+	else
+	{
+		// Next slot to pick per ID, newest instance first as RemoveItem does
+		TMap<FName, int32, TInlineSetAllocator<8>> NextPick;
+		DenseIndices.Reserve(ItemIDs.Num());
+
+		for (const FName ItemID : ItemIDs)
+		{
+			int32* PickSlot = NextPick.Find(ItemID);
+			if (!PickSlot)
+			{
+				const FInventoryItemBucket* Bucket = ItemIndex.Find(ItemID);
+				PickSlot = &NextPick.Add(ItemID, Bucket ? Bucket->NewestSlot : INDEX_NONE);
+			}
+
+			if (*PickSlot == INDEX_NONE)
+			{
+				UE_LOGFMT(LogTFItem, Warning, "UTFInventoryComponent: Cannot deposit items - '{ItemID}' not in inventory", ItemID);
+				return false;
+			}
+
+			DenseIndices.Add(ItemSlots[*PickSlot].DenseIndex);
+			*PickSlot = ItemSlots[*PickSlot].PrevSameID;
+		}
+	}
+
+	if (DenseIndices.IsEmpty())
+	{
+		return false;
+	}
+
+	if (DenseIndices.Num() > Container.GetContainerFreeSlots())
+	{
+		UE_LOGFMT(LogTFItem, Warning, "UTFInventoryComponent: Cannot deposit {Count} items - container has {Free} free slots",
+			DenseIndices.Num(), Container.GetContainerFreeSlots());
+		return false;
+	}
+
+	FTFItemDelta Delta;
+	Delta.Removed.Reserve(DenseIndices.Num());
+	for (const int32 DenseIndex : DenseIndices)
+	{
+		Delta.Removed.Add(Items[DenseIndex]);
+	}
+
+	if (!Container.AddItemsToContainer(Delta.Removed))
+	{
+		return false;
+	}
+
+	// Highest index first: each swap-remove then pulls in an entry that is unselected or already gone
+	DenseIndices.Sort(TGreater<int32>());
+	for (const int32 DenseIndex : DenseIndices)
+	{
+		RemoveItemAt(DenseIndex);
+	}
+
+	UE_LOGFMT(LogTFItem, Verbose, "UTFInventoryComponent: Deposited {Count} items into container (Weight: {Weight})", Delta.Removed.Num(), CurrentWeight);
+
+	BroadcastItemsChanged(Delta);
+	return true;
 }
 
-const FItemData* UTFInventoryComponent::GetItem(FName ItemID) const
+void UTFInventoryComponent::BroadcastItemsChanged(const FTFItemDelta& Delta)
+{
+	OnItemsChanged.Broadcast(Delta);
+	OnInventoryChanged.Broadcast(CurrentWeight, BackpackWeightLimit);
+}
+
+FInventoryItemHandle UTFInventoryComponent::AddItemInternal(const FItemData& Item)
 {
-	for (const FItemData& Item : Items)
+	const int32 SlotIndex = FreeItemSlots.Num() > 0 ? FreeItemSlots.Pop(EAllowShrinking::No) : ItemSlots.AddDefaulted();
+	const int32 DenseIndex = Items.Add(Item);
+
+	FInventoryItemSlot& Slot = ItemSlots[SlotIndex];
+	DenseToSlot.Add(SlotIndex);
+	Slot.DenseIndex = DenseIndex;
+
+	// Append to the add-order list and to the ItemID's own list
+	Slot.PrevAdded = NewestSlot;
+	Slot.NextAdded = INDEX_NONE;
+	if (NewestSlot != INDEX_NONE)
 	{
-		if (Item.ItemID == ItemID)
+		ItemSlots[NewestSlot].NextAdded = SlotIndex;
+	}
+	else
+	{
+		OldestSlot = SlotIndex;
+	}
+	NewestSlot = SlotIndex;
+
+	FInventoryItemBucket& Bucket = ItemIndex.FindOrAdd(Item.ItemID);
+	Slot.PrevSameID = Bucket.NewestSlot;
+	Slot.NextSameID = INDEX_NONE;
+	if (Bucket.NewestSlot != INDEX_NONE)
+	{
+		ItemSlots[Bucket.NewestSlot].NextSameID = SlotIndex;
+	}
+	else
+	{
+		Bucket.OldestSlot = SlotIndex;
+	}
+	Bucket.NewestSlot = SlotIndex;
+	++Bucket.Num;
+
+	CurrentWeight += Item.GetDefinition().Weight;
+
+	return FInventoryItemHandle(SlotIndex, Slot.Generation);
+}
+
+void UTFInventoryComponent::RemoveItemAt(int32 DenseIndex)
+{
+	const int32 LastIndex = Items.Num() - 1;
+	const FName RemovedID = Items[DenseIndex].ItemID;
+	const int32 RemovedSlot = DenseToSlot[DenseIndex];
+	FInventoryItemSlot& Slot = ItemSlots[RemovedSlot];
+
+	// Unlink from both lists, so many copies of one item stay constant-time
+	if (Slot.PrevAdded != INDEX_NONE)
+	{
+		ItemSlots[Slot.PrevAdded].NextAdded = Slot.NextAdded;
+	}
+	else
+	{
+		OldestSlot = Slot.NextAdded;
+	}
+
+	if (Slot.NextAdded != INDEX_NONE)
+	{
+		ItemSlots[Slot.NextAdded].PrevAdded = Slot.PrevAdded;
+	}
+	else
+	{
+		NewestSlot = Slot.PrevAdded;
+	}
+
+	FInventoryItemBucket& Bucket = ItemIndex.FindChecked(RemovedID);
+	if (Slot.PrevSameID != INDEX_NONE)
+	{
+		ItemSlots[Slot.PrevSameID].NextSameID = Slot.NextSameID;
+	}
+	else
+	{
+		Bucket.OldestSlot = Slot.NextSameID;
+	}
+
+	if (Slot.NextSameID != INDEX_NONE)
+	{
+		ItemSlots[Slot.NextSameID].PrevSameID = Slot.PrevSameID;
+	}
+	else
+	{
+		Bucket.NewestSlot = Slot.PrevSameID;
+	}
+
+	if (--Bucket.Num == 0)
+	{
+		ItemIndex.Remove(RemovedID);
+	}
+
+	// Retire the slot so outstanding handles go stale
+	Slot = FInventoryItemSlot{ INDEX_NONE, Slot.Generation + 1 };
+	FreeItemSlots.Add(RemovedSlot);
+
+	CurrentWeight = FMath::Max(0.0f, CurrentWeight - Items[DenseIndex].GetDefinition().Weight);
+
+	// Swap the last entry into the hole so removal stays constant-time
+	if (DenseIndex != LastIndex)
+	{
+		const int32 MovedSlot = DenseToSlot[LastIndex];
+		ItemSlots[MovedSlot].DenseIndex = DenseIndex;
+		DenseToSlot[DenseIndex] = MovedSlot;
+	}
+
+	Items.RemoveAtSwap(DenseIndex);
+	DenseToSlot.Pop(EAllowShrinking::No);
+}
+
+void UTFInventoryComponent::ResetItemIndex()
+{
+	for (int32 SlotIndex = 0; SlotIndex < ItemSlots.Num(); ++SlotIndex)
+	{
+		FInventoryItemSlot& Slot = ItemSlots[SlotIndex];
+		if (Slot.DenseIndex != INDEX_NONE)
 		{
-			return &Item;
+			Slot = FInventoryItemSlot{ INDEX_NONE, Slot.Generation + 1 };
+			FreeItemSlots.Add(SlotIndex);
 		}
 	}
-	return nullptr;
+
+	DenseToSlot.Reset();
+	ItemIndex.Reset();
+	OldestSlot = INDEX_NONE;
+	NewestSlot = INDEX_NONE;
 }
 
 bool UTFInventoryComponent::HasSpaceForItem(const FItemData& Item) const
@@ -193,7 +560,7 @@ bool UTFInventoryComponent::HasSpaceForItem(const FItemData& Item) const
 		return false;
 	}
 
-	if (!CanCarryWeight(Item.Weight))
+	if (!CanCarryWeight(Item.GetDefinition().Weight))
 	{
 		return false;
 	}
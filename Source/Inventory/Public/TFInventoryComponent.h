@@ -7,13 +7,75 @@
 #include "TFPickupableInterface.h"
 #include "TFInventoryComponent.generated.h"
 
+class ITFContainerInterface;
+
+/** Items that entered and left an inventory in one batched operation */
+struct FTFItemDelta
+{
+	TArray<FItemData> Added;
+	TArray<FItemData> Removed;
+
+	bool IsEmpty() const { return Added.IsEmpty() && Removed.IsEmpty(); }
+};
+
 DECLARE_MULTICAST_DELEGATE(FOnBackpackActivated);
 DECLARE_MULTICAST_DELEGATE(FOnBackpackDeactivated);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnItemAdded, const FItemData&);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnItemRemoved, FName);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnItemsChanged, const FTFItemDelta&);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnInventoryChanged, float, float);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnInventoryFull, const FText&);
 
+/**
+ * Stable reference to an item held by a UTFInventoryComponent.
+ * Survives removal of other items; goes stale once the referenced item is removed.
+ */
+struct FInventoryItemHandle
+{
+	int32 SlotIndex = INDEX_NONE;
+	uint32 Generation = 0;
+
+	FInventoryItemHandle() = default;
+
+	FInventoryItemHandle(int32 InSlotIndex, uint32 InGeneration)
+		: SlotIndex(InSlotIndex)
+		, Generation(InGeneration)
+	{
+	}
+
+	bool IsValid() const { return SlotIndex != INDEX_NONE; }
+
+	bool operator==(const FInventoryItemHandle& Other) const
+	{
+		return SlotIndex == Other.SlotIndex && Generation == Other.Generation;
+	}
+
+	bool operator!=(const FInventoryItemHandle& Other) const { return !(*this == Other); }
+};
+
+/** Sparse slot entry backing FInventoryItemHandle */
+struct FInventoryItemSlot
+{
+	int32 DenseIndex = INDEX_NONE;
+	uint32 Generation = 0;
+
+	/** Neighbouring slots in add order across every item; dense order changes on removal, this does not */
+	int32 PrevAdded = INDEX_NONE;
+	int32 NextAdded = INDEX_NONE;
+
+	/** Neighbouring slots in add order among instances of the same ItemID */
+	int32 PrevSameID = INDEX_NONE;
+	int32 NextSameID = INDEX_NONE;
+};
+
+/** ItemIndex entry: the instances of one ItemID, linked oldest to newest through their slots */
+struct FInventoryItemBucket
+{
+	int32 OldestSlot = INDEX_NONE;
+	int32 NewestSlot = INDEX_NONE;
+	int32 Num = 0;
+};
+
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class INVENTORY_API UTFInventoryComponent : public UActorComponent
 {
@@ -36,6 +98,7 @@ private:
 
 #pragma region Inventory State
 
+	/** Dense storage; removal swaps the last entry into the freed index, so order is not stable */
 	UPROPERTY(VisibleAnywhere, Category = "Inventory|Items")
 	TArray<FItemData> Items;
 
@@ -44,6 +107,33 @@ private:
 
 #pragma endregion Inventory State
 
+#pragma region Item Index
+
+	/** Slot table for handles; DenseIndex points into Items */
+	TArray<FInventoryItemSlot> ItemSlots;
+
+	/** Retired slots available for reuse */
+	TArray<int32> FreeItemSlots;
+
+	/** Parallel to Items: slot that owns each entry */
+	TArray<int32> DenseToSlot;
+
+	/** ItemID -> oldest and newest instance; the rest are reached through the slots' same-ID links */
+	TMap<FName, FInventoryItemBucket> ItemIndex;
+
+	/** Ends of the add-order list threaded through ItemSlots */
+	int32 OldestSlot = INDEX_NONE;
+	int32 NewestSlot = INDEX_NONE;
+
+	FInventoryItemHandle AddItemInternal(const FItemData& Item);
+	void RemoveItemAt(int32 DenseIndex);
+	void ResetItemIndex();
+
+	/** Broadcasts OnItemsChanged and OnInventoryChanged once for a batched operation */
+	void BroadcastItemsChanged(const FTFItemDelta& Delta);
+
+#pragma endregion Item Index
+
 protected:
 
 	virtual void BeginPlay() override;
@@ -58,6 +148,10 @@ public:
 	FOnBackpackDeactivated OnBackpackDeactivated;
 	FOnItemAdded OnItemAdded;
 	FOnItemRemoved OnItemRemoved;
+
+	/** Fires once per bulk transfer instead of OnItemAdded/OnItemRemoved per item */
+	FOnItemsChanged OnItemsChanged;
+
 	FOnInventoryChanged OnInventoryChanged;
 	FOnInventoryFull OnInventoryFull;
 
@@ -77,13 +171,52 @@ public:
 #pragma region Item Management
 
 	bool AddItem(const FItemData& Item);
+
+	/** Removes the newest instance of ItemID */
 	bool RemoveItem(FName ItemID);
+
 	bool HasItem(FName ItemID) const;
+
+	/** Oldest instance of ItemID */
 	const FItemData* GetItem(FName ItemID) const;
+
+	/** Dense storage order, which removals reshuffle; use GetHandlesInAddOrder for display */
 	const TArray<FItemData>& GetItems() const { return Items; }
+	int32 GetItemCount(FName ItemID) const;
 
 #pragma endregion Item Management
 
+#pragma region Handle API
+
+	/** Handle to the oldest instance of ItemID, the one GetItem returns */
+	FInventoryItemHandle FindItemHandle(FName ItemID) const;
+	FInventoryItemHandle GetHandleAt(int32 ArrayIndex) const;
+	bool IsValidHandle(FInventoryItemHandle Handle) const;
+	const FItemData* GetItemByHandle(FInventoryItemHandle Handle) const;
+	bool RemoveItemByHandle(FInventoryItemHandle Handle);
+
+	/** Handles of every held item, oldest first; stable across removals of other items. Linear, no sort */
+	void GetHandlesInAddOrder(TArray<FInventoryItemHandle>& OutHandles) const;
+
+	/** Handles of the Count most recently added items, oldest first; the items an add event just reported */
+	void GetNewestHandles(int32 Count, TArray<FInventoryItemHandle>& OutHandles) const;
+
+#pragma endregion Handle API
+
+#pragma region Bulk Transfer
+
+	/**
+	 * Moves the selected container items into the inventory, or all of them if ItemIDs is empty.
+	 * Repeat an ID to move several instances. Slots and weight are checked once up front;
+	 * nothing moves unless the whole selection fits.
+	 */
+	bool TakeFromContainer(ITFContainerInterface& Container, TConstArrayView<FName> ItemIDs = {});
+
+	/** Moves the selected inventory items, or all of them if ItemIDs is empty, into the container; all or nothing */
+	bool DepositToContainer(ITFContainerInterface& Container, TConstArrayView<FName> ItemIDs = {});
+
+#pragma endregion Bulk Transfer
+
 #pragma region Capacity Queries
 
 	bool HasSpaceForItem(const FItemData& Item) const;
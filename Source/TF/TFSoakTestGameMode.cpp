@@ -0,0 +1,375 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFSoakTestGameMode.h"
+#include "TFTypes.h"
+#include "TFPlayerCharacter.h"
+#include "TFInventoryComponent.h"
+#include "TFConfigSubsystem.h"
+#include "TFContainerInterface.h"
+#include "TFInteractableInterface.h"
+#include "TFInteractableGridSubsystem.h"
+#include "TFDayNightCycle.h"
+#include "EngineUtils.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+#include "TimerManager.h"
+#include "UObject/UObjectArray.h"
+
+ATFSoakTestGameMode::ATFSoakTestGameMode()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = true;
+}
+
+void ATFSoakTestGameMode::BeginPlay()
+{
+	Super::BeginPlay();
+
+	ReadCommandLine();
+	Random.Initialize(RandomSeed);
+
+	CreateSoakItems();
+	CacheContainers();
+
+	if (DayNightCycle)
+	{
+		DayNightCycle->SetCycleSpeed(RealSecondsPerGameHour);
+	}
+
+	if (ATFPlayerCharacter* Bot = GetBot())
+	{
+		RouteCenter = Bot->GetActorLocation();
+
+		if (!Bot->HasBackpack())
+		{
+			Bot->ActivateBackpack(BackpackSlots, BackpackWeightLimit);
+		}
+	}
+
+	if (!OpenCsv())
+	{
+		// Nothing to record; an unattended run would otherwise never exit
+		if (FApp::IsUnattended())
+		{
+			FPlatformMisc::RequestExit(false);
+		}
+		return;
+	}
+
+	StartTime = GetWorld()->GetTimeSeconds();
+	GetWorldTimerManager().SetTimer(ActionTimerHandle, this, &ATFSoakTestGameMode::RunBotStep, ActionInterval, true);
+	GetWorldTimerManager().SetTimer(SampleTimerHandle, this, &ATFSoakTestGameMode::RecordSample, SampleInterval, true);
+
+	UE_LOG(LogTFCharacter, Log, TEXT("TFSoakTestGameMode: Started soak (%.0f s, seed %d, %d containers)"), SoakDuration, RandomSeed, Containers.Num());
+}
+
+void ATFSoakTestGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	GetWorldTimerManager().ClearTimer(ActionTimerHandle);
+	GetWorldTimerManager().ClearTimer(SampleTimerHandle);
+
+	if (CsvWriter)
+	{
+		CsvWriter->Close();
+		CsvWriter.Reset();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ATFSoakTestGameMode::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	// Real frame time, unaffected by time dilation
+	const float FrameTime = static_cast<float>(FApp::GetDeltaTime());
+	FrameTimeSum += FrameTime;
+	FrameTimeMax = FMath::Max(FrameTimeMax, FrameTime);
+	++FrameCount;
+}
+
+ATFPlayerCharacter* ATFSoakTestGameMode::GetBot() const
+{
+	const APlayerController* PC = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+	return PC ? Cast<ATFPlayerCharacter>(PC->GetPawn()) : nullptr;
+}
+
+#pragma region Setup
+
+void ATFSoakTestGameMode::ReadCommandLine()
+{
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FParse::Value(CommandLine, TEXT("SoakDuration="), SoakDuration);
+	FParse::Value(CommandLine, TEXT("SoakSeed="), RandomSeed);
+	FParse::Value(CommandLine, TEXT("SoakCsv="), CsvFileName);
+	FParse::Value(CommandLine, TEXT("SoakBackpackSlots="), BackpackSlots);
+}
+
+void ATFSoakTestGameMode::CreateSoakItems()
+{
+	UTFConfigSubsystem* ConfigSubsystem = UTFConfigSubsystem::Get(this);
+	if (!ConfigSubsystem)
+	{
+		return;
+	}
+
+	SoakItems.Reset();
+	for (int32 Index = 0; Index < SoakItemTypes; ++Index)
+	{
+		FItemDefinition Definition;
+		Definition.ItemID = FName(*FString::Printf(TEXT("Soak_Item_%d"), Index));
+		Definition.ItemName = FText::FromName(Definition.ItemID);
+		Definition.Weight = 0.5f;
+		SoakItems.Add(ConfigSubsystem->InternItemDefinition(Definition));
+	}
+}
+
+void ATFSoakTestGameMode::CacheContainers()
+{
+	Containers.Reset();
+	for (TActorIterator<AActor> It(GetWorld()); It; ++It)
+	{
+		if (It->Implements<UTFContainerInterface>())
+		{
+			Containers.Add(*It);
+		}
+	}
+}
+
+bool ATFSoakTestGameMode::OpenCsv()
+{
+	const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("Soak") / CsvFileName;
+	CsvWriter.Reset(IFileManager::Get().CreateFileWriter(*CsvPath));
+	if (!CsvWriter)
+	{
+		UE_LOG(LogTFCharacter, Error, TEXT("TFSoakTestGameMode: Could not open %s"), *CsvPath);
+		return false;
+	}
+
+	WriteCsvLine(TEXT("ElapsedSeconds,Frames,AvgFrameMs,MaxFrameMs,UsedPhysicalMB,UsedVirtualMB,UObjects,Interactables,InventoryItems,GameDay,GameHour,Moves,Adds,Drops,Interacts,Transfers"));
+
+	UE_LOG(LogTFCharacter, Log, TEXT("TFSoakTestGameMode: Writing samples to %s"), *CsvPath);
+	return true;
+}
+
+void ATFSoakTestGameMode::WriteCsvLine(const FString& Line)
+{
+	if (CsvWriter)
+	{
+		const FTCHARToUTF8 Utf8Line(*(Line + LINE_TERMINATOR_ANSI));
+		CsvWriter->Serialize(const_cast<ANSICHAR*>(Utf8Line.Get()), Utf8Line.Length());
+		CsvWriter->Flush();
+	}
+}
+
+#pragma endregion Setup
+
+#pragma region Bot Actions
+
+void ATFSoakTestGameMode::RunBotStep()
+{
+	ATFPlayerCharacter* Bot = GetBot();
+	if (!Bot)
+	{
+		return;
+	}
+
+	const ESoakAction Action = static_cast<ESoakAction>(Random.RandRange(0, static_cast<int32>(ESoakAction::Count) - 1));
+
+	bool bPerformed = false;
+	switch (Action)
+	{
+	case ESoakAction::Move:
+		bPerformed = MoveAlongRoute(Bot);
+		break;
+	case ESoakAction::AddItem:
+		bPerformed = AddItem(Bot);
+		break;
+	case ESoakAction::DropItem:
+		bPerformed = DropItem(Bot);
+		break;
+	case ESoakAction::Interact:
+		bPerformed = InteractNearby(Bot);
+		break;
+	case ESoakAction::ContainerTransfer:
+		bPerformed = TransferThroughContainer(Bot);
+		break;
+	default:
+		break;
+	}
+
+	if (bPerformed)
+	{
+		++ActionCounts[static_cast<uint8>(Action)];
+	}
+}
+
+bool ATFSoakTestGameMode::MoveAlongRoute(ATFPlayerCharacter* Bot)
+{
+	// Teleport between waypoints; there is no input under -nullrhi and streaming and the grid only need the position
+	const float Angle = 2.0f * PI * NextWaypoint / RouteWaypoints;
+	const FVector Waypoint = RouteCenter + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * RouteRadius;
+	NextWaypoint = (NextWaypoint + 1) % RouteWaypoints;
+
+	const FRotator Facing = (Waypoint - Bot->GetActorLocation()).GetSafeNormal2D().Rotation();
+	return Bot->SetActorLocationAndRotation(Waypoint, Facing, false, nullptr, ETeleportType::TeleportPhysics);
+}
+
+bool ATFSoakTestGameMode::AddItem(ATFPlayerCharacter* Bot)
+{
+	if (SoakItems.IsEmpty())
+	{
+		return false;
+	}
+
+	const UTFItemDefinition* Definition = SoakItems[Random.RandRange(0, SoakItems.Num() - 1)];
+	return Bot->AddItem(FItemData(Definition));
+}
+
+bool ATFSoakTestGameMode::DropItem(ATFPlayerCharacter* Bot)
+{
+	// Drops go through the pickup pool; adds and drops are equally likely, so some items stay carried for deposits
+	const UTFInventoryComponent* Inventory = Bot->GetInventoryComponent();
+	if (!Inventory || Inventory->GetUsedSlots() == 0)
+	{
+		return false;
+	}
+
+	const FName ItemID = Inventory->GetItems()[Random.RandRange(0, Inventory->GetUsedSlots() - 1)].ItemID;
+	return Bot->DropItem(ItemID);
+}
+
+bool ATFSoakTestGameMode::InteractNearby(ATFPlayerCharacter* Bot)
+{
+	UTFInteractableGridSubsystem* Grid = UTFInteractableGridSubsystem::Get(this);
+	if (!Grid)
+	{
+		return false;
+	}
+
+	TArray<AActor*> Nearby;
+	Grid->GetInteractablesNear(Bot->GetActorLocation(), InteractRadius, Nearby);
+
+	// Containers open UI on interact; they are exercised through TransferThroughContainer instead
+	Nearby.RemoveAllSwap([](const AActor* Actor)
+	{
+		return !Actor || Actor->Implements<UTFContainerInterface>() || !Actor->Implements<UTFInteractableInterface>();
+	});
+
+	if (Nearby.IsEmpty())
+	{
+		return false;
+	}
+
+	ITFInteractableInterface* Interactable = Cast<ITFInteractableInterface>(Nearby[Random.RandRange(0, Nearby.Num() - 1)]);
+	return Interactable && Interactable->CanInteract(Bot) && Interactable->Interact(Bot);
+}
+
+bool ATFSoakTestGameMode::TransferThroughContainer(ATFPlayerCharacter* Bot)
+{
+	if (Containers.IsEmpty())
+	{
+		return false;
+	}
+
+	ITFContainerInterface* Container = Cast<ITFContainerInterface>(Containers[Random.RandRange(0, Containers.Num() - 1)].Get());
+	UTFInventoryComponent* Inventory = Bot->GetInventoryComponent();
+	if (!Container || !Inventory)
+	{
+		return false;
+	}
+
+	// Alternate deposit and take through the inventory's transfer calls, as the container widget would; occasionally as a whole batch
+	const bool bBatch = Random.FRand() < 0.2f;
+	if (Inventory->GetUsedSlots() > 0 && Container->ContainerHasSpace() && Random.FRand() < 0.5f)
+	{
+		if (bBatch)
+		{
+			return Inventory->DepositToContainer(*Container);
+		}
+
+		const FName ItemID = Inventory->GetItems()[Random.RandRange(0, Inventory->GetUsedSlots() - 1)].ItemID;
+		return Inventory->DepositToContainer(*Container, MakeArrayView(&ItemID, 1));
+	}
+
+	const TArray<FItemData>& ContainerItems = Container->GetContainerItems();
+	if (ContainerItems.IsEmpty())
+	{
+		return false;
+	}
+
+	if (bBatch)
+	{
+		return Inventory->TakeFromContainer(*Container);
+	}
+
+	const FName ItemID = ContainerItems[Random.RandRange(0, ContainerItems.Num() - 1)].ItemID;
+	return Inventory->TakeFromContainer(*Container, MakeArrayView(&ItemID, 1));
+}
+
+#pragma endregion Bot Actions
+
+#pragma region Sampling
+
+void ATFSoakTestGameMode::RecordSample()
+{
+	const double Elapsed = GetWorld()->GetTimeSeconds() - StartTime;
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	constexpr double BytesPerMB = 1024.0 * 1024.0;
+
+	const UTFInteractableGridSubsystem* Grid = UTFInteractableGridSubsystem::Get(this);
+	const ATFPlayerCharacter* Bot = GetBot();
+	const UTFInventoryComponent* Inventory = Bot ? Bot->GetInventoryComponent() : nullptr;
+
+	WriteCsvLine(FString::Printf(TEXT("%.1f,%d,%.3f,%.3f,%.1f,%.1f,%d,%d,%d,%d,%.2f,%d,%d,%d,%d,%d"),
+		Elapsed,
+		FrameCount,
+		FrameCount > 0 ? FrameTimeSum / FrameCount * 1000.0 : 0.0,
+		FrameTimeMax * 1000.0f,
+		MemoryStats.UsedPhysical / BytesPerMB,
+		MemoryStats.UsedVirtual / BytesPerMB,
+		GUObjectArray.GetObjectArrayNumMinusAvailable(),
+		Grid ? Grid->GetNumInteractables() : 0,
+		Inventory ? Inventory->GetUsedSlots() : 0,
+		DayNightCycle ? DayNightCycle->GetCurrentDay() : 0,
+		DayNightCycle ? DayNightCycle->GetCurrentTimeHours() : 0.0f,
+		ActionCounts[static_cast<uint8>(ESoakAction::Move)],
+		ActionCounts[static_cast<uint8>(ESoakAction::AddItem)],
+		ActionCounts[static_cast<uint8>(ESoakAction::DropItem)],
+		ActionCounts[static_cast<uint8>(ESoakAction::Interact)],
+		ActionCounts[static_cast<uint8>(ESoakAction::ContainerTransfer)]));
+
+	FrameTimeSum = 0.0;
+	FrameTimeMax = 0.0f;
+	FrameCount = 0;
+	FMemory::Memzero(ActionCounts);
+
+	if (SoakDuration > 0.0f && Elapsed >= SoakDuration)
+	{
+		FinishSoak();
+	}
+}
+
+void ATFSoakTestGameMode::FinishSoak()
+{
+	GetWorldTimerManager().ClearTimer(ActionTimerHandle);
+	GetWorldTimerManager().ClearTimer(SampleTimerHandle);
+
+	if (CsvWriter)
+	{
+		CsvWriter->Close();
+		CsvWriter.Reset();
+	}
+
+	UE_LOG(LogTFCharacter, Log, TEXT("TFSoakTestGameMode: Soak finished after %.0f s"), SoakDuration);
+
+	if (FApp::IsUnattended())
+	{
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+#pragma endregion Sampling
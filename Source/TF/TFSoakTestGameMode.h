@@ -0,0 +1,138 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TFGameMode.h"
+#include "TFSoakTestGameMode.generated.h"
+
+class ATFPlayerCharacter;
+class UTFItemDefinition;
+
+/**
+ * Unattended soak run: drives the player pawn through a scripted route, dropping,
+ * picking up, interacting and moving items through containers, and appends frame time,
+ * memory and UObject counts to a CSV under Saved/Soak.
+ * Run with: TF <Map>?game=/Script/TF.TFSoakTestGameMode -game -nullrhi -unattended
+ * Optional switches: -SoakDuration=<seconds> -SoakSeed=<int> -SoakCsv=<file name> -SoakBackpackSlots=<int>
+ */
+UCLASS()
+class TF_API ATFSoakTestGameMode : public ATFGameMode
+{
+	GENERATED_BODY()
+
+#pragma region Soak Settings
+
+protected:
+
+	/** Seconds to run before writing the last sample and exiting; 0 runs until closed */
+	UPROPERTY(EditDefaultsOnly, Category = "Soak")
+	float SoakDuration = 3600.0f;
+
+	/** Seconds between bot actions */
+	UPROPERTY(EditDefaultsOnly, Category = "Soak", meta = (ClampMin = "0.01"))
+	float ActionInterval = 0.1f;
+
+	/** Seconds between CSV samples */
+	UPROPERTY(EditDefaultsOnly, Category = "Soak", meta = (ClampMin = "0.1"))
+	float SampleInterval = 1.0f;
+
+	/** Radius of the circular route around the spawn point */
+	UPROPERTY(EditDefaultsOnly, Category = "Soak", meta = (ClampMin = "0.0"))
+	float RouteRadius = 1500.0f;
+
+	/** Number of waypoints on the route */
+	UPROPERTY(EditDefaultsOnly, Category = "Soak", meta = (ClampMin = "1"))
+	int32 RouteWaypoints = 16;
+
+	/** Interactables within this distance of the bot are candidates for Interact */
+	UPROPERTY(EditDefaultsOnly, Category = "Soak", meta = (ClampMin = "0.0"))
+	float InteractRadius = 500.0f;
+
+	/** Distinct item types the bot adds and drops */
+	UPROPERTY(EditDefaultsOnly, Category = "Soak", meta = (ClampMin = "1"))
+	int32 SoakItemTypes = 8;
+
+	/** Backpack the bot activates at start; without one it cannot carry anything */
+	UPROPERTY(EditDefaultsOnly, Category = "Soak", meta = (ClampMin = "1"))
+	int32 BackpackSlots = 20;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Soak", meta = (ClampMin = "0.0"))
+	float BackpackWeightLimit = 50.0f;
+
+	/** Day/night speed during the run, so a session covers many cycles */
+	UPROPERTY(EditDefaultsOnly, Category = "Soak", meta = (ClampMin = "0.1"))
+	float RealSecondsPerGameHour = 5.0f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Soak")
+	int32 RandomSeed = 1337;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Soak")
+	FString CsvFileName = TEXT("SoakTest.csv");
+
+#pragma endregion Soak Settings
+
+private:
+
+	enum class ESoakAction : uint8
+	{
+		Move,
+		AddItem,
+		DropItem,
+		Interact,
+		ContainerTransfer,
+		Count
+	};
+
+	UPROPERTY()
+	TArray<const UTFItemDefinition*> SoakItems;
+
+	TArray<TWeakObjectPtr<AActor>> Containers;
+
+	TUniquePtr<FArchive> CsvWriter;
+
+	FRandomStream Random;
+	FVector RouteCenter = FVector::ZeroVector;
+	int32 NextWaypoint = 0;
+	double StartTime = 0.0;
+
+	FTimerHandle ActionTimerHandle;
+	FTimerHandle SampleTimerHandle;
+
+	/** Frame times since the last sample */
+	double FrameTimeSum = 0.0;
+	float FrameTimeMax = 0.0f;
+	int32 FrameCount = 0;
+
+	/** Actions since the last sample */
+	int32 ActionCounts[static_cast<uint8>(ESoakAction::Count)] = {};
+
+	ATFPlayerCharacter* GetBot() const;
+
+	void ReadCommandLine();
+	void CreateSoakItems();
+	void CacheContainers();
+	bool OpenCsv();
+	void WriteCsvLine(const FString& Line);
+
+	void RunBotStep();
+	bool MoveAlongRoute(ATFPlayerCharacter* Bot);
+	bool AddItem(ATFPlayerCharacter* Bot);
+	bool DropItem(ATFPlayerCharacter* Bot);
+	bool InteractNearby(ATFPlayerCharacter* Bot);
+	bool TransferThroughContainer(ATFPlayerCharacter* Bot);
+
+	void RecordSample();
+	void FinishSoak();
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+
+	ATFSoakTestGameMode();
+
+	virtual void Tick(float DeltaSeconds) override;
+};
@@ -2,4 +2,9 @@
 
 
 #include "TFNPCCharacter.h"
+#include "TFStatsComponent.h"
 
+ATFNPCCharacter::ATFNPCCharacter()
+{
+	StatsComponent = CreateDefaultSubobject<UTFStatsComponent>(TEXT("StatsComponent"));
+}
@@ -7,6 +7,9 @@
 #include "TFInteractionComponent.h"
 #include "TFInventoryComponent.h"
 #include "TFPickupableActor.h"
+#include "TFPickupPoolSubsystem.h"
+#include "TFItemAssetSubsystem.h"
+#include "TFPickupPhysicsSubsystem.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/StaticMeshComponent.h"
@@ -48,12 +51,28 @@ void ATFPlayerCharacter::BeginPlay()
 	Super::BeginPlay();
 
 	BindStaminaEvents();
+
+	if (InventoryComponent)
+	{
+		InventoryComponent->OnItemAdded.AddUObject(this, &ATFPlayerCharacter::HandleItemAdded);
+		InventoryComponent->OnItemRemoved.AddUObject(this, &ATFPlayerCharacter::HandleItemRemoved);
+		InventoryComponent->OnItemsChanged.AddUObject(this, &ATFPlayerCharacter::HandleItemsChanged);
+	}
 }
 
 void ATFPlayerCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	UnbindStaminaEvents();
 
+	if (InventoryComponent)
+	{
+		InventoryComponent->OnItemAdded.RemoveAll(this);
+		InventoryComponent->OnItemRemoved.RemoveAll(this);
+		InventoryComponent->OnItemsChanged.RemoveAll(this);
+	}
+
+	ReleaseAllCarriedItems();
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -279,6 +298,7 @@ void ATFPlayerCharacter::ConfirmBackpackEquip()
 		{
 			EquippedBackpackData = BackpackActor->GetItemData();
 			ItemsToRestore = BackpackActor->GetStoredInventoryItems();
+			PreloadCarriedItem(EquippedBackpackData);
 		}
 	}
 
@@ -294,7 +314,15 @@ void ATFPlayerCharacter::ConfirmBackpackEquip()
 
 	if (PendingBackpackActor.IsValid())
 	{
-		PendingBackpackActor->Destroy();
+		if (ATFPickupableActor* BackpackActor = Cast<ATFPickupableActor>(PendingBackpackActor.Get()))
+		{
+			BackpackActor->ReleaseToPool();
+		}
+		else
+		{
+			PendingBackpackActor->Destroy();
+		}
+
 		PendingBackpackActor = nullptr;
 	}
 }
@@ -330,8 +358,8 @@ bool ATFPlayerCharacter::DropItem(FName ItemID)
 		return false;
 	}
 
-	UWorld* World = GetWorld();
-	if (!World)
+	UTFPickupPoolSubsystem* PickupPool = UTFPickupPoolSubsystem::Get(this);
+	if (!PickupPool)
 	{
 		return false;
 	}
@@ -346,28 +374,11 @@ bool ATFPlayerCharacter::DropItem(FName ItemID)
 	FVector DropLocation = GetActorLocation() + GetActorForwardVector() * 150.0f;
 	DropLocation.Z -= 50.0f;
 
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Owner = this;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
-	ATFPickupableActor* DroppedActor = World->SpawnActor<ATFPickupableActor>(
-		ATFPickupableActor::StaticClass(),
-		DropLocation,
-		FRotator::ZeroRotator,
-		SpawnParams
-	);
+	ATFPickupableActor* DroppedActor = PickupPool->AcquirePickup(DropLocation, this);
 
 	if (DroppedActor)
 	{
 		DroppedActor->SetItemData(DroppedItemData);
-
-		if (UStaticMeshComponent* DroppedMesh = DroppedActor->GetMeshComponent())
-		{
-			if (!DroppedMesh->GetStaticMesh())
-			{
-				DroppedMesh->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Sphere.Sphere")));
-			}
-		}
 	}
 
 	return true;
@@ -380,11 +391,8 @@ bool ATFPlayerCharacter::DropBackpack()
 		return false;
 	}
 
-	int32 Slots = InventoryComponent->GetBackpackSlots();
-	float WeightLimit = InventoryComponent->GetBackpackWeightLimit();
-
-	UWorld* World = GetWorld();
-	if (!World)
+	UTFPickupPoolSubsystem* PickupPool = UTFPickupPoolSubsystem::Get(this);
+	if (!PickupPool)
 	{
 		return false;
 	}
@@ -393,32 +401,11 @@ bool ATFPlayerCharacter::DropBackpack()
 
 	FVector DropLocation = GetActorLocation() + GetActorForwardVector() * 100.0f;
 
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.Owner = this;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
-	ATFPickupableActor* DroppedBackpack = World->SpawnActor<ATFPickupableActor>(
-		ATFPickupableActor::StaticClass(),
-		DropLocation,
-		FRotator::ZeroRotator,
-		SpawnParams
-	);
+	ATFPickupableActor* DroppedBackpack = PickupPool->AcquirePickup(DropLocation, this);
 
 	if (DroppedBackpack)
 	{
-		FItemData BackpackData = EquippedBackpackData;
-		BackpackData.BackpackSlots = Slots;
-		BackpackData.BackpackWeightLimit = WeightLimit;
-
-		DroppedBackpack->SetItemData(BackpackData);
-
-		if (UStaticMeshComponent* BackpackMeshComp = DroppedBackpack->GetMeshComponent())
-		{
-			if (!BackpackMeshComp->GetStaticMesh())
-			{
-				BackpackMeshComp->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
-			}
-		}
+		DroppedBackpack->SetItemData(EquippedBackpackData);
 		DroppedBackpack->SetStoredInventoryItems(StoredItems);
 
 		if (UStaticMeshComponent* BackpackMesh = DroppedBackpack->GetMeshComponent())
@@ -430,6 +417,12 @@ bool ATFPlayerCharacter::DropBackpack()
 			BackpackMesh->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
 			BackpackMesh->SetSimulatePhysics(true);
 
+			// Let frozen pickups around the drop point react to the thrown backpack
+			if (UTFPickupPhysicsSubsystem* PickupPhysics = UTFPickupPhysicsSubsystem::Get(this))
+			{
+				PickupPhysics->WakePickupsNear(DropLocation, 300.0f);
+			}
+
 			FVector Impulse = GetActorForwardVector() * 200.0f + FVector(0.0f, 0.0f, 100.0f);
 			BackpackMesh->AddImpulse(Impulse, NAME_None, true);
 		}
@@ -437,6 +430,9 @@ bool ATFPlayerCharacter::DropBackpack()
 
 	EquippedBackpackData = FItemData();
 
+	// The stored items left with the backpack without per-item events
+	ReleaseAllCarriedItems();
+
 	UE_LOG(LogTFCharacter, Log, TEXT("Backpack dropped with %d items"), StoredItems.Num());
 	return true;
 }
@@ -484,4 +480,89 @@ float ATFPlayerCharacter::GetRemainingCapacity() const
 	return InventoryComponent ? InventoryComponent->GetRemainingCapacity() : 0.0f;
 }
 
+#pragma region Carried Mesh Preload
+
+void ATFPlayerCharacter::PreloadCarriedItem(const FItemData& Item)
+{
+	const TSoftObjectPtr<UStaticMesh>& Mesh = Item.GetDefinition().ItemMesh;
+	UTFItemAssetSubsystem* ItemAssets = UTFItemAssetSubsystem::Get(this);
+	if (Mesh.IsNull() || !ItemAssets)
+	{
+		return;
+	}
+
+	// Most adds are another instance of a carried item and stop here
+	TArray<FSoftObjectPath, TInlineAllocator<1>>& Meshes = PreloadedItemMeshes.FindOrAdd(Item.ItemID);
+	const FSoftObjectPath MeshPath = Mesh.ToSoftObjectPath();
+	if (!Meshes.Contains(MeshPath))
+	{
+		Meshes.Add(MeshPath);
+		ItemAssets->AddPreloadedMesh(MeshPath);
+	}
+}
+
+void ATFPlayerCharacter::ReleaseCarriedItem(FName ItemID)
+{
+	// Other instances of the item still need its mesh
+	if ((InventoryComponent && InventoryComponent->HasItem(ItemID)) || EquippedBackpackData.ItemID == ItemID)
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath, TInlineAllocator<1>> Meshes;
+	if (!PreloadedItemMeshes.RemoveAndCopyValue(ItemID, Meshes))
+	{
+		return;
+	}
+
+	if (UTFItemAssetSubsystem* ItemAssets = UTFItemAssetSubsystem::Get(this))
+	{
+		for (const FSoftObjectPath& MeshPath : Meshes)
+		{
+			ItemAssets->RemovePreloadedMesh(MeshPath);
+		}
+	}
+}
+
+void ATFPlayerCharacter::ReleaseAllCarriedItems()
+{
+	if (UTFItemAssetSubsystem* ItemAssets = UTFItemAssetSubsystem::Get(this))
+	{
+		for (const TPair<FName, TArray<FSoftObjectPath, TInlineAllocator<1>>>& Pair : PreloadedItemMeshes)
+		{
+			for (const FSoftObjectPath& MeshPath : Pair.Value)
+			{
+				ItemAssets->RemovePreloadedMesh(MeshPath);
+			}
+		}
+	}
+
+	PreloadedItemMeshes.Reset();
+}
+
+void ATFPlayerCharacter::HandleItemAdded(const FItemData& Item)
+{
+	PreloadCarriedItem(Item);
+}
+
+void ATFPlayerCharacter::HandleItemRemoved(FName ItemID)
+{
+	ReleaseCarriedItem(ItemID);
+}
+
+void ATFPlayerCharacter::HandleItemsChanged(const FTFItemDelta& Delta)
+{
+	for (const FItemData& Item : Delta.Added)
+	{
+		PreloadCarriedItem(Item);
+	}
+
+	for (const FItemData& Item : Delta.Removed)
+	{
+		ReleaseCarriedItem(Item.ItemID);
+	}
+}
+
+#pragma endregion Carried Mesh Preload
+
 #pragma endregion Inventory
@@ -6,10 +6,25 @@
 #include "TFCharacterBase.h"
 #include "TFNPCCharacter.generated.h"
 
+class UTFStatsComponent;
 
 UCLASS(Abstract, NotBlueprintable)
 class TFCHARACTERS_API ATFNPCCharacter : public ATFCharacterBase
 {
 	GENERATED_BODY()
-	
+
+private:
+
+#pragma region Components
+
+	UPROPERTY(VisibleAnywhere, Category = "Components")
+	UTFStatsComponent* StatsComponent;
+
+#pragma endregion Components
+
+public:
+
+	ATFNPCCharacter();
+
+	UTFStatsComponent* GetStatsComponent() const { return StatsComponent; }
 };
@@ -12,6 +12,7 @@ class UTFStaminaComponent;
 class UTFStatsComponent;
 class UTFInteractionComponent;
 class UTFInventoryComponent;
+struct FTFItemDelta;
 
 UENUM()
 enum class ESprintBlockReason : uint8
@@ -188,7 +189,25 @@ private:
 	int32 PendingBackpackSlots = 0;
 	float PendingBackpackWeightLimit = 0.0f;
 	TWeakObjectPtr<AActor> PendingBackpackActor;
+
+	UPROPERTY()
 	FItemData EquippedBackpackData;
 
+#pragma region Carried Mesh Preload
+
+	/** Meshes preloaded per carried ItemID; released once no instance of the ID is carried */
+	TMap<FName, TArray<FSoftObjectPath, TInlineAllocator<1>>> PreloadedItemMeshes;
+
+	/** Keeps meshes of carried items streamed in so dropping them never hitches; only touches the items that changed */
+	void PreloadCarriedItem(const FItemData& Item);
+	void ReleaseCarriedItem(FName ItemID);
+	void ReleaseAllCarriedItems();
+
+	void HandleItemAdded(const FItemData& Item);
+	void HandleItemRemoved(FName ItemID);
+	void HandleItemsChanged(const FTFItemDelta& Delta);
+
+#pragma endregion Carried Mesh Preload
+
 #pragma endregion Inventory
 };
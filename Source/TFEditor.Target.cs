@@ -15,6 +15,7 @@ public class TFEditorTarget : TargetRules
 		ExtraModuleNames.Add("Widgets");
 		ExtraModuleNames.Add("TFWorldActors");
 		ExtraModuleNames.Add("WorldEnvironment");
+		ExtraModuleNames.Add("TFTests");
 		
 	}
 }
@@ -0,0 +1,179 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TFConfigSubsystem.h"
+#include "TFTypes.h"
+#include "HAL/FileManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace
+{
+	constexpr int32 ActorCounts[] = { 1000, 5000 };
+
+	/** What each pickup did in BeginPlay before the registry: open its own section and read every key */
+	bool LoadItemSectionLegacy(const FString& SectionName)
+	{
+		FString ConfigFilePath;
+		if (!TFConfigUtils::LoadINISection(TEXT("ItemConfig.ini"), SectionName, ConfigFilePath, LogTFTests, true))
+		{
+			return false;
+		}
+
+		FString StringValue;
+		float FloatValue = 0.0f;
+		int32 IntValue = 0;
+		bool bBoolValue = false;
+
+		GConfig->GetString(*SectionName, TEXT("ItemType"), StringValue, ConfigFilePath);
+		GConfig->GetString(*SectionName, TEXT("ItemName"), StringValue, ConfigFilePath);
+		GConfig->GetString(*SectionName, TEXT("ItemDescription"), StringValue, ConfigFilePath);
+		GConfig->GetString(*SectionName, TEXT("ItemMesh"), StringValue, ConfigFilePath);
+		GConfig->GetFloat(*SectionName, TEXT("Weight"), FloatValue, ConfigFilePath);
+		GConfig->GetFloat(*SectionName, TEXT("HungerRestore"), FloatValue, ConfigFilePath);
+		GConfig->GetFloat(*SectionName, TEXT("ThirstRestore"), FloatValue, ConfigFilePath);
+		GConfig->GetInt(*SectionName, TEXT("BackpackSlots"), IntValue, ConfigFilePath);
+		GConfig->GetFloat(*SectionName, TEXT("BackpackWeightLimit"), FloatValue, ConfigFilePath);
+		GConfig->GetBool(*SectionName, TEXT("bDestroyOnPickup"), bBoolValue, ConfigFilePath);
+		GConfig->GetFloat(*SectionName, TEXT("DestroyDelay"), FloatValue, ConfigFilePath);
+		GConfig->GetFloat(*SectionName, TEXT("MaxInteractionDistance"), FloatValue, ConfigFilePath);
+
+		return true;
+	}
+
+	FString GetTestBlobPath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("Automation") / TEXT("TFPerf") / TEXT("TFConfig.bin");
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTFConfigLoadPerfTest, "TF.Perf.ConfigLoad", TF_PERF_TEST_FLAGS)
+
+bool FTFConfigLoadPerfTest::RunTest(const FString& Parameters)
+{
+	FTFPerfReport Report(*this, TEXT("ConfigLoad"));
+
+	TArray<FString> SectionNames;
+	FString ConfigFilePath;
+	if (!TestTrue(TEXT("ItemConfig.ini has sections"), TFConfigUtils::GetINISectionNames(TEXT("ItemConfig.ini"), SectionNames, ConfigFilePath, LogTFTests) && SectionNames.Num() > 0))
+	{
+		return false;
+	}
+
+	// Standalone instance, as the cook commandlet uses; no game instance needed
+	TStrongObjectPtr<UTFConfigSubsystem> ConfigSubsystem(NewObject<UTFConfigSubsystem>(GetTransientPackage()));
+
+	for (const int32 Count : ActorCounts)
+	{
+		TArray<FName> ActorItemIDs;
+		ActorItemIDs.Reserve(Count);
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			ActorItemIDs.Emplace(*SectionNames[Index % SectionNames.Num()]);
+		}
+
+		// Registry: every file parsed once, then one hash lookup per actor
+		int32 NumResolved = 0;
+		Report.Measure(FString::Printf(TEXT("Registry_%d"), Count), 10, [&]
+		{
+			ConfigSubsystem->ParseINIFiles();
+
+			NumResolved = 0;
+			for (const FName ItemID : ActorItemIDs)
+			{
+				NumResolved += ConfigSubsystem->FindItemConfig(ItemID) ? 1 : 0;
+			}
+		});
+
+		TestEqual(FString::Printf(TEXT("Registry resolves all %d actors"), Count), NumResolved, Count);
+
+		// Legacy: every actor reads the file and its section itself; reported for comparison, never gated
+		Report.MeasureReference(FString::Printf(TEXT("Legacy_%d"), Count), 3, [&]
+		{
+			NumResolved = 0;
+			for (const FName ItemID : ActorItemIDs)
+			{
+				NumResolved += LoadItemSectionLegacy(ItemID.ToString()) ? 1 : 0;
+			}
+		});
+
+		TestEqual(FString::Printf(TEXT("Legacy path resolves all %d actors"), Count), NumResolved, Count);
+	}
+
+	return Report.Finish();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTFCookedConfigPerfTest, "TF.Perf.CookedConfig", TF_PERF_TEST_FLAGS)
+
+bool FTFCookedConfigPerfTest::RunTest(const FString& Parameters)
+{
+	FTFPerfReport Report(*this, TEXT("CookedConfig"));
+
+	TStrongObjectPtr<UTFConfigSubsystem> ConfigSubsystem(NewObject<UTFConfigSubsystem>(GetTransientPackage()));
+	ConfigSubsystem->ParseINIFiles();
+
+	const FString BlobPath = GetTestBlobPath();
+	if (!TestTrue(TEXT("Cooked blob written"), ConfigSubsystem->SaveCookedConfigs(BlobPath)))
+	{
+		return false;
+	}
+
+	Report.Measure(TEXT("ParseINI"), 20, [&]
+	{
+		ConfigSubsystem->ParseINIFiles();
+	});
+
+	// Includes the stat-only staleness check non-shipping builds run; shipping skips it
+	bool bLoaded = true;
+	Report.Measure(TEXT("CookedLoad"), 20, [&]
+	{
+		bLoaded &= ConfigSubsystem->LoadCookedConfigs(BlobPath);
+	});
+
+	TestTrue(TEXT("Fresh cooked blob loads"), bLoaded);
+
+	IFileManager::Get().Delete(*BlobPath);
+	return Report.Finish();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTFStaleCookedConfigTest, "TF.Config.StaleCookedBlob", TF_PRODUCT_TEST_FLAGS)
+
+bool FTFStaleCookedConfigTest::RunTest(const FString& Parameters)
+{
+	TStrongObjectPtr<UTFConfigSubsystem> ConfigSubsystem(NewObject<UTFConfigSubsystem>(GetTransientPackage()));
+	ConfigSubsystem->ParseINIFiles();
+
+	const FString BlobPath = GetTestBlobPath();
+	if (!TestTrue(TEXT("Cooked blob written"), ConfigSubsystem->SaveCookedConfigs(BlobPath)))
+	{
+		return false;
+	}
+
+	TestTrue(TEXT("Blob matching the INI files loads"), ConfigSubsystem->LoadCookedConfigs(BlobPath));
+
+	TestTrue(TEXT("Fresh blob passes the packaging check"), UTFConfigSubsystem::IsCookedConfigCurrent(BlobPath));
+
+	// Flip the first source file size after magic, version and stamp count, as if an INI file changed after the cook
+	TArray<uint8> Bytes;
+	FFileHelper::LoadFileToArray(Bytes, *BlobPath);
+	if (TestTrue(TEXT("Blob has a header"), Bytes.Num() >= 28))
+	{
+		Bytes[12] ^= 0xFF;
+		FFileHelper::SaveArrayToFile(Bytes, *BlobPath);
+
+		TestFalse(TEXT("Stale blob fails the packaging check"), UTFConfigSubsystem::IsCookedConfigCurrent(BlobPath));
+
+		AddExpectedError(TEXT("older than the INI files"), EAutomationExpectedErrorFlags::Contains, 1);
+		TestFalse(TEXT("Stale blob is rejected so the INI files win"), ConfigSubsystem->LoadCookedConfigs(BlobPath));
+	}
+
+	IFileManager::Get().Delete(*BlobPath);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
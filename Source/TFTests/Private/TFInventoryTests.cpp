@@ -0,0 +1,371 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TFBaseContainerActor.h"
+#include "TFInventoryComponent.h"
+#include "TFPickupableInterface.h"
+#include "Engine/World.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace
+{
+	constexpr int32 InventorySizes[] = { 10, 100, 1000 };
+	constexpr int32 DistinctItemTypes = 16;
+
+	/** Item instances cycling through DistinctItemTypes definitions */
+	TArray<FItemData> MakeItems(int32 Count, TArray<TStrongObjectPtr<UTFItemDefinition>>& OutDefinitions)
+	{
+		OutDefinitions.Reset();
+		for (int32 Type = 0; Type < DistinctItemTypes; ++Type)
+		{
+			OutDefinitions.Emplace(TFTestUtils::MakeItemDefinition(FName(*FString::Printf(TEXT("PerfItem_%d"), Type))));
+		}
+
+		TArray<FItemData> Items;
+		Items.Reserve(Count);
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Items.Emplace(OutDefinitions[Index % DistinctItemTypes].Get());
+		}
+		return Items;
+	}
+
+	UTFInventoryComponent* MakeInventory(int32 Slots)
+	{
+		UTFInventoryComponent* Inventory = NewObject<UTFInventoryComponent>(GetTransientPackage());
+		Inventory->ActivateBackpack(Slots, Slots * 10.0f);
+		return Inventory;
+	}
+
+	/** The inventory before the ItemID index: one array, linear scans, order-preserving removal */
+	struct FLegacyInventory
+	{
+		TArray<FItemData> Items;
+		int32 Slots = 0;
+		float WeightLimit = 0.0f;
+		float CurrentWeight = 0.0f;
+
+		explicit FLegacyInventory(int32 InSlots)
+			: Slots(InSlots)
+			, WeightLimit(InSlots * 10.0f)
+		{
+		}
+
+		bool AddItem(const FItemData& Item)
+		{
+			const float Weight = Item.GetDefinition().Weight;
+			if (Items.Num() >= Slots || CurrentWeight + Weight > WeightLimit)
+			{
+				return false;
+			}
+
+			Items.Add(Item);
+			CurrentWeight += Weight;
+			return true;
+		}
+
+		bool RemoveItem(FName ItemID)
+		{
+			for (int32 i = Items.Num() - 1; i >= 0; --i)
+			{
+				if (Items[i].ItemID == ItemID)
+				{
+					CurrentWeight = FMath::Max(0.0f, CurrentWeight - Items[i].GetDefinition().Weight);
+					Items.RemoveAt(i);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		const FItemData* GetItem(FName ItemID) const
+		{
+			return Items.FindByPredicate([ItemID](const FItemData& Item) { return Item.ItemID == ItemID; });
+		}
+
+		bool HasItem(FName ItemID) const
+		{
+			return GetItem(ItemID) != nullptr;
+		}
+
+		int32 GetItemCount(FName ItemID) const
+		{
+			int32 Count = 0;
+			for (const FItemData& Item : Items)
+			{
+				if (Item.ItemID == ItemID)
+				{
+					++Count;
+				}
+			}
+			return Count;
+		}
+	};
+
+	/** Item IDs on both sides of a transfer plus the carried weight, to check a failed transfer moved nothing */
+	struct FTransferSnapshot
+	{
+		TArray<FName> InventoryIDs;
+		TArray<FName> ContainerIDs;
+		float Weight = 0.0f;
+
+		FTransferSnapshot(const UTFInventoryComponent& Inventory, const ITFContainerInterface& Container)
+			: Weight(Inventory.GetCurrentWeight())
+		{
+			TArray<FInventoryItemHandle> Handles;
+			Inventory.GetHandlesInAddOrder(Handles);
+			for (const FInventoryItemHandle Handle : Handles)
+			{
+				InventoryIDs.Add(Inventory.GetItemByHandle(Handle)->ItemID);
+			}
+
+			for (const FItemData& Item : Container.GetContainerItems())
+			{
+				ContainerIDs.Add(Item.ItemID);
+			}
+		}
+
+		bool operator==(const FTransferSnapshot& Other) const
+		{
+			return InventoryIDs == Other.InventoryIDs && ContainerIDs == Other.ContainerIDs && FMath::IsNearlyEqual(Weight, Other.Weight);
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTFInventoryPerfTest, "TF.Perf.Inventory", TF_PERF_TEST_FLAGS)
+
+bool FTFInventoryPerfTest::RunTest(const FString& Parameters)
+{
+	FTFPerfReport Report(*this, TEXT("Inventory"));
+
+	for (const int32 Count : InventorySizes)
+	{
+		TArray<TStrongObjectPtr<UTFItemDefinition>> Definitions;
+		const TArray<FItemData> Items = MakeItems(Count, Definitions);
+
+		TStrongObjectPtr<UTFInventoryComponent> Inventory;
+
+		// Fill to capacity, then empty it again by ItemID
+		Report.Measure(FString::Printf(TEXT("AddRemove_%d"), Count), 20,
+			[&] { Inventory.Reset(MakeInventory(Count)); },
+			[&]
+			{
+				for (const FItemData& Item : Items)
+				{
+					Inventory->AddItem(Item);
+				}
+				for (const FItemData& Item : Items)
+				{
+					Inventory->RemoveItem(Item.ItemID);
+				}
+			});
+
+		TestEqual(FString::Printf(TEXT("Inventory empty after AddRemove_%d"), Count), Inventory->GetUsedSlots(), 0);
+
+		Inventory.Reset(MakeInventory(Count));
+		for (const FItemData& Item : Items)
+		{
+			Inventory->AddItem(Item);
+		}
+
+		// One HasItem, GetItem and GetItemCount per held item
+		int32 Found = 0;
+		Report.Measure(FString::Printf(TEXT("Lookup_%d"), Count), 20, [&]
+		{
+			Found = 0;
+			for (const FItemData& Item : Items)
+			{
+				if (Inventory->HasItem(Item.ItemID) && Inventory->GetItem(Item.ItemID) && Inventory->GetItemCount(Item.ItemID) > 0)
+				{
+					++Found;
+				}
+			}
+		});
+
+		TestEqual(FString::Printf(TEXT("Every item found in Lookup_%d"), Count), Found, Count);
+
+		// The same workloads against the pre-index implementation, reported for comparison and never gated
+		TUniquePtr<FLegacyInventory> Legacy;
+
+		Report.MeasureReference(FString::Printf(TEXT("Legacy_AddRemove_%d"), Count), 20,
+			[&] { Legacy = MakeUnique<FLegacyInventory>(Count); },
+			[&]
+			{
+				for (const FItemData& Item : Items)
+				{
+					Legacy->AddItem(Item);
+				}
+				for (const FItemData& Item : Items)
+				{
+					Legacy->RemoveItem(Item.ItemID);
+				}
+			});
+
+		TestEqual(FString::Printf(TEXT("Legacy inventory empty after Legacy_AddRemove_%d"), Count), Legacy->Items.Num(), 0);
+
+		Legacy = MakeUnique<FLegacyInventory>(Count);
+		for (const FItemData& Item : Items)
+		{
+			Legacy->AddItem(Item);
+		}
+
+		Report.MeasureReference(FString::Printf(TEXT("Legacy_Lookup_%d"), Count), 20, [&]
+		{
+			Found = 0;
+			for (const FItemData& Item : Items)
+			{
+				if (Legacy->HasItem(Item.ItemID) && Legacy->GetItem(Item.ItemID) && Legacy->GetItemCount(Item.ItemID) > 0)
+				{
+					++Found;
+				}
+			}
+		});
+
+		TestEqual(FString::Printf(TEXT("Every item found in Legacy_Lookup_%d"), Count), Found, Count);
+	}
+
+	return Report.Finish();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTFInventoryAddOrderTest, "TF.Inventory.AddOrder", TF_PRODUCT_TEST_FLAGS)
+
+bool FTFInventoryAddOrderTest::RunTest(const FString& Parameters)
+{
+	TArray<TStrongObjectPtr<UTFItemDefinition>> Definitions;
+	const TArray<FItemData> Items = MakeItems(DistinctItemTypes, Definitions);
+
+	TStrongObjectPtr<UTFInventoryComponent> Inventory(MakeInventory(DistinctItemTypes));
+	for (const FItemData& Item : Items)
+	{
+		Inventory->AddItem(Item);
+	}
+
+	// Removing from the front and middle swaps later items into the holes in dense storage
+	Inventory->RemoveItem(Items[0].ItemID);
+	Inventory->RemoveItem(Items[5].ItemID);
+	Inventory->AddItem(Items[0]);
+
+	TArray<FName> Expected;
+	for (int32 Index = 1; Index < Items.Num(); ++Index)
+	{
+		if (Index != 5)
+		{
+			Expected.Add(Items[Index].ItemID);
+		}
+	}
+	Expected.Add(Items[0].ItemID);
+
+	TArray<FInventoryItemHandle> Handles;
+	Inventory->GetHandlesInAddOrder(Handles);
+
+	TArray<FName> Actual;
+	for (const FInventoryItemHandle Handle : Handles)
+	{
+		Actual.Add(Inventory->GetItemByHandle(Handle)->ItemID);
+	}
+
+	TestEqual(TEXT("Handle count"), Actual.Num(), Expected.Num());
+	TestTrue(TEXT("Items listed in add order after removals"), Actual == Expected);
+
+	// Every index lookup still lands on its own item after the bucket and dense swaps
+	for (const FName ItemID : Expected)
+	{
+		const FItemData* Item = Inventory->GetItem(ItemID);
+		TestTrue(FString::Printf(TEXT("GetItem(%s) resolves"), *ItemID.ToString()), Item && Item->ItemID == ItemID);
+		TestEqual(FString::Printf(TEXT("GetItemCount(%s)"), *ItemID.ToString()), Inventory->GetItemCount(ItemID), 1);
+	}
+
+	// Instances of one ItemID: lookups resolve the oldest, RemoveItem takes the newest
+	const FName RepeatedID = Items[1].ItemID;
+	const FInventoryItemHandle Oldest = Inventory->FindItemHandle(RepeatedID);
+	Inventory->AddItem(Items[1]);
+	Inventory->AddItem(Items[1]);
+
+	Inventory->GetHandlesInAddOrder(Handles);
+	const FInventoryItemHandle Middle = Handles[Handles.Num() - 2];
+	const FInventoryItemHandle Newest = Handles.Last();
+
+	TestTrue(TEXT("FindItemHandle returns the oldest instance"), Inventory->FindItemHandle(RepeatedID) == Oldest);
+	TestTrue(TEXT("GetItem returns the oldest instance"), Inventory->GetItem(RepeatedID) == Inventory->GetItemByHandle(Oldest));
+	TestEqual(TEXT("GetItemCount counts every instance"), Inventory->GetItemCount(RepeatedID), 3);
+
+	Inventory->RemoveItem(RepeatedID);
+	TestFalse(TEXT("RemoveItem removes the newest instance"), Inventory->IsValidHandle(Newest));
+	TestTrue(TEXT("Older instances survive RemoveItem"), Inventory->IsValidHandle(Oldest) && Inventory->IsValidHandle(Middle));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTFInventoryBulkTransferTest, "TF.Inventory.BulkTransfer", TF_PRODUCT_TEST_FLAGS)
+
+bool FTFInventoryBulkTransferTest::RunTest(const FString& Parameters)
+{
+	FTFTestWorld TestWorld;
+	ATFBaseContainerActor* Container = TestWorld.Get()->SpawnActor<ATFBaseContainerActor>();
+	if (!TestNotNull(TEXT("Container"), Container) || !TestTrue(TEXT("Container has room to test with"), Container->GetMaxCapacity() >= 3))
+	{
+		return false;
+	}
+
+	const int32 Capacity = Container->GetMaxCapacity();
+
+	TArray<TStrongObjectPtr<UTFItemDefinition>> Definitions;
+	const TArray<FItemData> Items = MakeItems(Capacity + 2, Definitions);
+	TStrongObjectPtr<UTFItemDefinition> Heavy(TFTestUtils::MakeItemDefinition(TEXT("HeavyItem"), 1000.0f));
+
+	TStrongObjectPtr<UTFInventoryComponent> Inventory(MakeInventory(Capacity + 2));
+	for (const FItemData& Item : Items)
+	{
+		Inventory->AddItem(Item);
+	}
+
+	int32 NumDeltas = 0;
+	Inventory->OnItemsChanged.AddLambda([&NumDeltas](const FTFItemDelta&) { ++NumDeltas; });
+
+	// Leave one free container slot, then deposit two: the second does not fit, so neither moves
+	TArray<FItemData> Filler;
+	for (int32 Index = 0; Index < Capacity - 1; ++Index)
+	{
+		Filler.Add(Items[Index]);
+	}
+	Container->AddItemsToContainer(Filler);
+
+	const FTransferSnapshot BeforeDeposit(*Inventory, *Container);
+	const FName Overflow[] = { Items[0].ItemID, Items[1].ItemID };
+	TestFalse(TEXT("Overflowing deposit fails"), Inventory->DepositToContainer(*Container, Overflow));
+	TestTrue(TEXT("Overflowing deposit leaves both sides unchanged"), FTransferSnapshot(*Inventory, *Container) == BeforeDeposit);
+
+	// One missing ID fails the whole selection, including the IDs that are present
+	const FName PartlyMissing[] = { Items[0].ItemID, TEXT("NotHeld") };
+	TestFalse(TEXT("Deposit with a missing ID fails"), Inventory->DepositToContainer(*Container, PartlyMissing));
+	TestTrue(TEXT("Deposit with a missing ID leaves both sides unchanged"), FTransferSnapshot(*Inventory, *Container) == BeforeDeposit);
+
+	// Taking everything needs more slots than the inventory has free
+	const FTransferSnapshot BeforeTake(*Inventory, *Container);
+	TestFalse(TEXT("Take beyond free slots fails"), Inventory->TakeFromContainer(*Container));
+	TestTrue(TEXT("Failed take leaves both sides unchanged"), FTransferSnapshot(*Inventory, *Container) == BeforeTake);
+
+	// Slots are fine once the inventory is emptied, but the heavy item is over the weight limit
+	Inventory->DeactivateBackpack();
+	Inventory->ActivateBackpack(Capacity + 2, (Capacity + 2) * 10.0f);
+	Container->AddItemToContainer(FItemData(Heavy.Get()));
+
+	const FTransferSnapshot BeforeHeavyTake(*Inventory, *Container);
+	TestFalse(TEXT("Overweight take fails"), Inventory->TakeFromContainer(*Container));
+	TestTrue(TEXT("Overweight take leaves both sides unchanged"), FTransferSnapshot(*Inventory, *Container) == BeforeHeavyTake);
+	TestEqual(TEXT("Failed transfers broadcast nothing"), NumDeltas, 0);
+
+	// A selection that fits moves as one batch with one delta
+	const FName Fits[] = { Items[0].ItemID, Items[1].ItemID };
+	TestTrue(TEXT("Take that fits succeeds"), Inventory->TakeFromContainer(*Container, Fits));
+	TestEqual(TEXT("Both items taken"), Inventory->GetUsedSlots(), 2);
+	TestEqual(TEXT("Container lost both items"), Container->GetContainerUsedSlots(), Capacity - 2);
+	TestEqual(TEXT("One delta per batch"), NumDeltas, 1);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
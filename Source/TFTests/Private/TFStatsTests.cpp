@@ -0,0 +1,111 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TFStatsComponent.h"
+#include "TFStatsSubsystem.h"
+#include "TFTypes.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/ConfigCacheIni.h"
+
+namespace
+{
+	constexpr int32 StatComponentCounts[] = { 100, 1000, 10000 };
+
+	const TCHAR* StatsSubsystemSection = TEXT("/Script/Components.TFStatsSubsystem");
+
+	/** Switches the stats subsystem between analytic and batched decay for worlds created in scope */
+	struct FScopedDecayMode
+	{
+		bool bPreviousAnalytic = false;
+
+		explicit FScopedDecayMode(bool bAnalytic)
+		{
+			GConfig->GetBool(StatsSubsystemSection, TEXT("bAnalyticDecay"), bPreviousAnalytic, GGameIni);
+			Apply(bAnalytic);
+		}
+
+		~FScopedDecayMode()
+		{
+			Apply(bPreviousAnalytic);
+		}
+
+		static void Apply(bool bAnalytic)
+		{
+			GConfig->SetBool(StatsSubsystemSection, TEXT("bAnalyticDecay"), bAnalytic, GGameIni);
+			GetMutableDefault<UTFStatsSubsystem>()->ReloadConfig();
+		}
+	};
+
+	void AddStatComponents(UWorld* World, int32 Count, TArray<UTFStatsComponent*>& OutComponents)
+	{
+		AActor* Host = World->SpawnActor<AActor>();
+		OutComponents.Reserve(Count);
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			UTFStatsComponent* Component = NewObject<UTFStatsComponent>(Host);
+			Component->RegisterComponent();
+			OutComponents.Add(Component);
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTFStatDecayPerfTest, "TF.Perf.StatDecay", TF_PERF_TEST_FLAGS)
+
+bool FTFStatDecayPerfTest::RunTest(const FString& Parameters)
+{
+	FTFPerfReport Report(*this, TEXT("StatDecay"));
+
+	float DecayBatchInterval = 0.25f;
+	GConfig->GetFloat(StatsSubsystemSection, TEXT("DecayBatchInterval"), DecayBatchInterval, GGameIni);
+
+	for (const int32 Count : StatComponentCounts)
+	{
+		// Batched: one timer-driven pass over every row
+		{
+			FScopedDecayMode DecayMode(false);
+			FTFTestWorld TestWorld;
+
+			TArray<UTFStatsComponent*> Components;
+			AddStatComponents(TestWorld.Get(), Count, Components);
+
+			const UTFStatsSubsystem* Subsystem = TestWorld.Get()->GetSubsystem<UTFStatsSubsystem>();
+			TestTrue(TEXT("Stats subsystem exists"), Subsystem != nullptr);
+			TestTrue(FString::Printf(TEXT("Rows registered for %d components"), Count), Subsystem && Subsystem->GetNumRows() >= Count);
+
+			Report.Measure(FString::Printf(TEXT("BatchedPass_%d"), Count), 20, [&]
+			{
+				TestWorld.Tick(DecayBatchInterval);
+			});
+		}
+
+		// Analytic: no pass; the cost moves to reading values
+		{
+			FScopedDecayMode DecayMode(true);
+			FTFTestWorld TestWorld;
+
+			TArray<UTFStatsComponent*> Components;
+			AddStatComponents(TestWorld.Get(), Count, Components);
+
+			float Sum = 0.0f;
+			Report.Measure(FString::Printf(TEXT("AnalyticQuery_%d"), Count), 20, [&]
+			{
+				Sum = 0.0f;
+				for (const UTFStatsComponent* Component : Components)
+				{
+					Sum += Component->GetCurrentHunger() + Component->GetCurrentThirst();
+				}
+			});
+
+			TestTrue(TEXT("Analytic values readable"), Sum > 0.0f);
+		}
+	}
+
+	return Report.Finish();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
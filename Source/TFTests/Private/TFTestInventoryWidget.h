@@ -0,0 +1,20 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TFInventoryWidget.h"
+#include "Components/ListView.h"
+#include "TFTestInventoryWidget.generated.h"
+
+/** Inventory widget that runs without a widget tree; the test supplies the list the designer would bind */
+UCLASS(Transient)
+class UTFTestInventoryWidget : public UTFInventoryWidget
+{
+	GENERATED_BODY()
+
+public:
+
+	void CreateListView() { ItemListView = NewObject<UListView>(this); }
+	UListView* GetListView() const { return ItemListView; }
+};
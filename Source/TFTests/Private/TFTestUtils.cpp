@@ -0,0 +1,232 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TFTypes.h"
+#include "TFPickupableInterface.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProperties.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+DEFINE_LOG_CATEGORY(LogTFTests);
+
+#pragma region Test World
+
+FTFTestWorld::FTFTestWorld()
+{
+	World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("TFTestWorld"));
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	// No game mode to start play; begin it directly so spawned actors run BeginPlay
+	if (AWorldSettings* WorldSettings = World->GetWorldSettings())
+	{
+		WorldSettings->NotifyBeginPlay();
+	}
+}
+
+FTFTestWorld::~FTFTestWorld()
+{
+	if (World)
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+		World = nullptr;
+	}
+}
+
+void FTFTestWorld::Tick(float DeltaSeconds)
+{
+	// Timers and tickable objects tick at most once per frame number
+	++GFrameCounter;
+	World->Tick(LEVELTICK_All, DeltaSeconds);
+}
+
+#pragma endregion Test World
+
+UTFItemDefinition* TFTestUtils::MakeItemDefinition(FName ItemID, float Weight)
+{
+	FItemDefinition Definition;
+	Definition.ItemID = ItemID;
+	Definition.ItemName = FText::FromName(ItemID);
+	Definition.Weight = Weight;
+	return UTFItemDefinition::Create(Definition, GetTransientPackage());
+}
+
+#pragma region Perf Report
+
+FTFPerfReport::FTFPerfReport(FAutomationTestBase& InTest, const FString& InSuiteName)
+	: Test(InTest)
+	, SuiteName(InSuiteName)
+{
+}
+
+double FTFPerfReport::Measure(const FString& MetricName, int32 Iterations, TFunctionRef<void()> Body)
+{
+	return MeasureSamples(MetricName, Iterations, [] {}, Body, true);
+}
+
+double FTFPerfReport::Measure(const FString& MetricName, int32 Iterations, TFunctionRef<void()> Setup, TFunctionRef<void()> Body)
+{
+	return MeasureSamples(MetricName, Iterations, Setup, Body, true);
+}
+
+double FTFPerfReport::MeasureReference(const FString& MetricName, int32 Iterations, TFunctionRef<void()> Body)
+{
+	return MeasureSamples(MetricName, Iterations, [] {}, Body, false);
+}
+
+double FTFPerfReport::MeasureReference(const FString& MetricName, int32 Iterations, TFunctionRef<void()> Setup, TFunctionRef<void()> Body)
+{
+	return MeasureSamples(MetricName, Iterations, Setup, Body, false);
+}
+
+double FTFPerfReport::MeasureSamples(const FString& MetricName, int32 Iterations, TFunctionRef<void()> Setup, TFunctionRef<void()> Body, bool bGated)
+{
+	Iterations = FMath::Max(1, Iterations);
+
+	Setup();
+	Body();
+
+	TArray<double> Samples;
+	Samples.Reserve(Iterations);
+
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		Setup();
+
+		const double StartTime = FPlatformTime::Seconds();
+		Body();
+		Samples.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	Samples.Sort();
+	const double MedianMs = Samples[Samples.Num() / 2];
+	Record(MetricName, Iterations, MedianMs, Samples[0], bGated);
+	return MedianMs;
+}
+
+void FTFPerfReport::Record(const FString& MetricName, int32 Iterations, double MedianMs, double MinMs, bool bGated)
+{
+	FMetric& Metric = Metrics.AddDefaulted_GetRef();
+	Metric.Name = MetricName;
+	Metric.Iterations = Iterations;
+	Metric.MedianMs = MedianMs;
+	Metric.MinMs = MinMs;
+	Metric.bGated = bGated;
+
+	UE_LOG(LogTFTests, Display, TEXT("%s.%s: median %.4f ms, min %.4f ms over %d iterations"), *SuiteName, *MetricName, MedianMs, MinMs, Iterations);
+}
+
+bool FTFPerfReport::Finish()
+{
+	// Budgets are recorded from optimized builds; Debug timings are only reported
+	const bool bCheckBudgets = !UE_BUILD_DEBUG && !FParse::Param(FCommandLine::Get(), TEXT("TFPerfNoBaseline"));
+
+	double Tolerance = 1.0;
+	FParse::Value(FCommandLine::Get(), TEXT("TFPerfTolerance="), Tolerance);
+
+	FConfigFile Baseline;
+	Baseline.Read(TFConfigUtils::GetConfigFilePath(TEXT("TFPerfBaseline.ini")));
+
+	bool bAllPassed = true;
+	for (FMetric& Metric : Metrics)
+	{
+		if (!Metric.bGated)
+		{
+			continue;
+		}
+
+		FString BudgetString;
+		if (Baseline.GetString(*SuiteName, *Metric.Name, BudgetString))
+		{
+			Metric.BudgetMs = FCString::Atod(*BudgetString);
+		}
+
+		if (!bCheckBudgets)
+		{
+			continue;
+		}
+
+		if (Metric.BudgetMs <= 0.0)
+		{
+			Test.AddWarning(FString::Printf(TEXT("%s.%s has no budget in TFPerfBaseline.ini"), *SuiteName, *Metric.Name));
+			continue;
+		}
+
+		if (Metric.MedianMs > Metric.BudgetMs * Tolerance)
+		{
+			Metric.bPassed = false;
+			bAllPassed = false;
+			Test.AddError(FString::Printf(TEXT("%s.%s regressed: median %.4f ms, budget %.4f ms (tolerance x%.2f)"),
+				*SuiteName, *Metric.Name, Metric.MedianMs, Metric.BudgetMs, Tolerance));
+		}
+	}
+
+	const FString OutputDir = FPaths::ProjectSavedDir() / TEXT("Automation") / TEXT("TFPerf");
+	IFileManager::Get().MakeDirectory(*OutputDir, true);
+
+	FString Csv = TEXT("Metric,Iterations,MedianMs,MinMs,BudgetMs,Result\n");
+	FString SuggestedBaseline = FString::Printf(TEXT("[%s]\n"), *SuiteName);
+
+	TArray<TSharedPtr<FJsonValue>> JsonMetrics;
+	for (const FMetric& Metric : Metrics)
+	{
+		const TCHAR* Result = !Metric.bGated ? TEXT("Reference") : (!bCheckBudgets ? TEXT("Recorded") : (Metric.bPassed ? TEXT("Passed") : TEXT("Failed")));
+		Csv += FString::Printf(TEXT("%s,%d,%.4f,%.4f,%.4f,%s\n"), *Metric.Name, Metric.Iterations, Metric.MedianMs, Metric.MinMs, Metric.BudgetMs, Result);
+
+		// Twice the measured median leaves room for machine noise
+		if (Metric.bGated)
+		{
+			SuggestedBaseline += FString::Printf(TEXT("%s=%.4f\n"), *Metric.Name, Metric.MedianMs * 2.0);
+		}
+
+		TSharedRef<FJsonObject> JsonMetric = MakeShared<FJsonObject>();
+		JsonMetric->SetStringField(TEXT("Metric"), Metric.Name);
+		JsonMetric->SetNumberField(TEXT("Iterations"), Metric.Iterations);
+		JsonMetric->SetNumberField(TEXT("MedianMs"), Metric.MedianMs);
+		JsonMetric->SetNumberField(TEXT("MinMs"), Metric.MinMs);
+		JsonMetric->SetNumberField(TEXT("BudgetMs"), Metric.BudgetMs);
+		JsonMetric->SetStringField(TEXT("Result"), Result);
+		JsonMetrics.Add(MakeShared<FJsonValueObject>(JsonMetric));
+	}
+
+	TSharedRef<FJsonObject> JsonRoot = MakeShared<FJsonObject>();
+	JsonRoot->SetStringField(TEXT("Suite"), SuiteName);
+	JsonRoot->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+	JsonRoot->SetStringField(TEXT("Configuration"), LexToString(FApp::GetBuildConfiguration()));
+	JsonRoot->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+	JsonRoot->SetNumberField(TEXT("Tolerance"), Tolerance);
+	JsonRoot->SetArrayField(TEXT("Metrics"), JsonMetrics);
+
+	FString Json;
+	FJsonSerializer::Serialize(JsonRoot, TJsonWriterFactory<>::Create(&Json));
+
+	FFileHelper::SaveStringToFile(Csv, *(OutputDir / SuiteName + TEXT(".csv")));
+	FFileHelper::SaveStringToFile(Json, *(OutputDir / SuiteName + TEXT(".json")));
+	FFileHelper::SaveStringToFile(SuggestedBaseline, *(OutputDir / SuiteName + TEXT(".baseline.ini")));
+
+	UE_LOG(LogTFTests, Display, TEXT("%s: wrote %d metrics to %s"), *SuiteName, Metrics.Num(), *OutputDir);
+
+	return bAllPassed;
+}
+
+#pragma endregion Perf Report
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,99 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class UWorld;
+class UTFItemDefinition;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogTFTests, Log, All);
+
+/** Flags shared by the TF.Perf tests */
+#define TF_PERF_TEST_FLAGS (EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+/** Flags shared by the functional TF tests */
+#define TF_PRODUCT_TEST_FLAGS (EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Bare game world for tests that need actors, subsystems or timers.
+ * Play has begun once constructed, so spawned actors run BeginPlay; destroyed with the scope.
+ */
+class FTFTestWorld
+{
+public:
+
+	FTFTestWorld();
+	~FTFTestWorld();
+
+	UWorld* Get() const { return World; }
+
+	/** Ticks the world once, timers and tickable subsystems included */
+	void Tick(float DeltaSeconds);
+
+private:
+
+	UWorld* World = nullptr;
+};
+
+namespace TFTestUtils
+{
+	/** Transient item definition with the given ID and weight */
+	UTFItemDefinition* MakeItemDefinition(FName ItemID, float Weight = 1.0f);
+}
+
+/**
+ * Timings for one perf suite.
+ * Results go to Saved/Automation/TFPerf/<Suite>.csv and .json; each metric's median is checked
+ * against its budget in the [<Suite>] section of Config/TFPerfBaseline.ini and fails the test
+ * when over. <Suite>.baseline.ini next to the results holds budgets suggested from this run.
+ * Reference metrics (MeasureReference) are reported alongside but never checked or budgeted.
+ *
+ * Run headless: UnrealEditor-Cmd TF.uproject -ExecCmds="Automation RunTests TF.Perf;Quit" -nullrhi -unattended
+ * Optional switches: -TFPerfTolerance=<scale> widens every budget, -TFPerfNoBaseline only records.
+ */
+class FTFPerfReport
+{
+public:
+
+	FTFPerfReport(FAutomationTestBase& InTest, const FString& InSuiteName);
+
+	/** Runs Body once to warm up, then Iterations times; records and returns the median in milliseconds */
+	double Measure(const FString& MetricName, int32 Iterations, TFunctionRef<void()> Body);
+
+	/** As above, with Setup run untimed before each iteration */
+	double Measure(const FString& MetricName, int32 Iterations, TFunctionRef<void()> Setup, TFunctionRef<void()> Body);
+
+	/** As Measure, for comparison workloads such as a replaced implementation; reported, never gated */
+	double MeasureReference(const FString& MetricName, int32 Iterations, TFunctionRef<void()> Body);
+	double MeasureReference(const FString& MetricName, int32 Iterations, TFunctionRef<void()> Setup, TFunctionRef<void()> Body);
+
+	void Record(const FString& MetricName, int32 Iterations, double MedianMs, double MinMs, bool bGated = true);
+
+	/** Writes the result files and checks every metric against its budget; false on any regression */
+	bool Finish();
+
+private:
+
+	struct FMetric
+	{
+		FString Name;
+		int32 Iterations = 0;
+		double MedianMs = 0.0;
+		double MinMs = 0.0;
+		double BudgetMs = 0.0;
+		bool bGated = true;
+		bool bPassed = true;
+	};
+
+	double MeasureSamples(const FString& MetricName, int32 Iterations, TFunctionRef<void()> Setup, TFunctionRef<void()> Body, bool bGated);
+
+	FAutomationTestBase& Test;
+	FString SuiteName;
+	TArray<FMetric> Metrics;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,17 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFTestsModule.h"
+
+#define LOCTEXT_NAMESPACE "FTFTestsModule"
+
+void FTFTestsModule::StartupModule()
+{
+}
+
+void FTFTestsModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FTFTestsModule, TFTests)
@@ -0,0 +1,111 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TFTestInventoryWidget.h"
+#include "TFInventoryComponent.h"
+#include "TFInventoryItemViewData.h"
+#include "TFPickupableInterface.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace
+{
+	constexpr int32 NumItems = 12;
+
+	UTFInventoryComponent* MakeFilledInventory(const TCHAR* Prefix, TArray<TStrongObjectPtr<UTFItemDefinition>>& OutDefinitions)
+	{
+		UTFInventoryComponent* Inventory = NewObject<UTFInventoryComponent>(GetTransientPackage());
+		Inventory->ActivateBackpack(NumItems, NumItems * 10.0f);
+
+		for (int32 Index = 0; Index < NumItems; ++Index)
+		{
+			UTFItemDefinition* Definition = TFTestUtils::MakeItemDefinition(FName(*FString::Printf(TEXT("%s_%d"), Prefix, Index)));
+			OutDefinitions.Emplace(Definition);
+			Inventory->AddItem(FItemData(Definition));
+		}
+		return Inventory;
+	}
+
+	/** Every row shows the item its handle points at, in the inventory's add order */
+	bool RowsMatchInventory(FAutomationTestBase& Test, const FString& What, UListView* ListView, const UTFInventoryComponent* Inventory)
+	{
+		TArray<FInventoryItemHandle> Handles;
+		Inventory->GetHandlesInAddOrder(Handles);
+
+		if (!Test.TestEqual(What + TEXT(": row count"), ListView->GetNumItems(), Handles.Num()))
+		{
+			return false;
+		}
+
+		bool bAllMatch = true;
+		for (int32 Index = 0; Index < Handles.Num(); ++Index)
+		{
+			const UTFInventoryItemViewData* ViewData = Cast<UTFInventoryItemViewData>(ListView->GetItemAt(Index));
+			const FItemData* Item = Inventory->GetItemByHandle(Handles[Index]);
+
+			bAllMatch &= ViewData && ViewData->Handle == Handles[Index] && Item && ViewData->ItemData.ItemID == Item->ItemID;
+		}
+
+		return Test.TestTrue(What + TEXT(": rows show their own items in add order"), bAllMatch);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTFInventoryWidgetViewDataTest, "TF.Widgets.InventoryViewData", TF_PRODUCT_TEST_FLAGS)
+
+bool FTFInventoryWidgetViewDataTest::RunTest(const FString& Parameters)
+{
+	TArray<TStrongObjectPtr<UTFItemDefinition>> Definitions;
+	TStrongObjectPtr<UTFInventoryComponent> Inventory(MakeFilledInventory(TEXT("WidgetItem"), Definitions));
+	TStrongObjectPtr<UTFInventoryComponent> OtherInventory(MakeFilledInventory(TEXT("OtherItem"), Definitions));
+
+	TStrongObjectPtr<UTFTestInventoryWidget> Widget(NewObject<UTFTestInventoryWidget>(GetTransientPackage()));
+	Widget->CreateListView();
+	UListView* ListView = Widget->GetListView();
+
+	Widget->SetInventoryComponent(Inventory.Get());
+	RowsMatchInventory(*this, TEXT("Initial fill"), ListView, Inventory.Get());
+	TestEqual(TEXT("One view data per item"), Widget->GetNumViewDataAllocated(), NumItems);
+
+	// Objects by handle, to check rows for surviving items are never rebound
+	TMap<int32, UObject*> RowBySlot;
+	for (int32 Index = 0; Index < ListView->GetNumItems(); ++Index)
+	{
+		const UTFInventoryItemViewData* ViewData = Cast<UTFInventoryItemViewData>(ListView->GetItemAt(Index));
+		RowBySlot.Add(ViewData->Handle.SlotIndex, ListView->GetItemAt(Index));
+	}
+
+	// Removing from the middle reshuffles dense storage; rows must not follow it
+	const FName RemovedID = Definitions[4]->Get().ItemID;
+	Inventory->RemoveItem(RemovedID);
+	RowsMatchInventory(*this, TEXT("After removal"), ListView, Inventory.Get());
+
+	// The freed row is recycled for a different item and must carry that item's data
+	Inventory->AddItem(FItemData(Definitions[NumItems + 1].Get()));
+	RowsMatchInventory(*this, TEXT("After re-add"), ListView, Inventory.Get());
+	TestEqual(TEXT("Re-add reuses the pooled view data"), Widget->GetNumViewDataAllocated(), NumItems);
+
+	bool bIdentityKept = true;
+	for (int32 Index = 0; Index < ListView->GetNumItems() - 1; ++Index)
+	{
+		const UTFInventoryItemViewData* ViewData = Cast<UTFInventoryItemViewData>(ListView->GetItemAt(Index));
+		bIdentityKept &= RowBySlot.FindRef(ViewData->Handle.SlotIndex) == ViewData;
+	}
+	TestTrue(TEXT("Surviving rows keep their view data"), bIdentityKept);
+
+	// Toggling the inventory and swapping sources stays within the pool
+	for (int32 Pass = 0; Pass < 10; ++Pass)
+	{
+		Widget->RefreshDisplay();
+		Widget->SetInventoryComponent(OtherInventory.Get());
+		Widget->SetInventoryComponent(Inventory.Get());
+	}
+
+	RowsMatchInventory(*this, TEXT("After refreshes and swaps"), ListView, Inventory.Get());
+	TestEqual(TEXT("No view data allocated by refreshes or swaps"), Widget->GetNumViewDataAllocated(), NumItems);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
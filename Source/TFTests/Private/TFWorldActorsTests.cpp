@@ -0,0 +1,146 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TFBaseDoorActor.h"
+#include "TFDoorAnimationSubsystem.h"
+#include "TFInteractableActor.h"
+#include "TFInteractableGridSubsystem.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+
+namespace
+{
+	constexpr int32 DoorCounts[] = { 10, 100, 1000 };
+	constexpr int32 InteractableCounts[] = { 100, 1000, 5000 };
+
+	/** Detection queries per measured iteration, each from a random point in the field */
+	constexpr int32 QueriesPerIteration = 1000;
+	constexpr float InteractableSpacing = 200.0f;
+	constexpr float DetectionDistance = 300.0f;
+
+	FVector GetGridLocation(int32 Index, int32 Count)
+	{
+		const int32 Columns = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+		return FVector((Index % Columns) * InteractableSpacing, (Index / Columns) * InteractableSpacing, 0.0f);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTFDoorAnimationPerfTest, "TF.Perf.DoorAnimation", TF_PERF_TEST_FLAGS)
+
+bool FTFDoorAnimationPerfTest::RunTest(const FString& Parameters)
+{
+	FTFPerfReport Report(*this, TEXT("DoorAnimation"));
+
+	for (const int32 Count : DoorCounts)
+	{
+		FTFTestWorld TestWorld;
+		UWorld* World = TestWorld.Get();
+
+		APawn* Opener = World->SpawnActor<APawn>(FVector(0.0f, -500.0f, 0.0f), FRotator::ZeroRotator);
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			ATFBaseDoorActor* Door = World->SpawnActor<ATFBaseDoorActor>(GetGridLocation(Index, Count), FRotator::ZeroRotator);
+			Door->OpenDoor(Opener);
+		}
+
+		UTFDoorAnimationSubsystem* DoorAnimation = World->GetSubsystem<UTFDoorAnimationSubsystem>();
+		if (!TestNotNull(TEXT("Door animation subsystem"), DoorAnimation))
+		{
+			return false;
+		}
+
+		TestEqual(FString::Printf(TEXT("All %d doors moving"), Count), DoorAnimation->GetNumMovingDoors(), Count);
+
+		// 1 ms steps keep every door mid-swing across all iterations
+		Report.Measure(FString::Printf(TEXT("Tick_%d"), Count), 100, [&]
+		{
+			DoorAnimation->Tick(0.001f);
+		});
+
+		TestEqual(FString::Printf(TEXT("All %d doors still moving after measuring"), Count), DoorAnimation->GetNumMovingDoors(), Count);
+	}
+
+	return Report.Finish();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTFInteractionPerfTest, "TF.Perf.Interaction", TF_PERF_TEST_FLAGS)
+
+bool FTFInteractionPerfTest::RunTest(const FString& Parameters)
+{
+	FTFPerfReport Report(*this, TEXT("Interaction"));
+
+	UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!TestNotNull(TEXT("Engine cube mesh"), CubeMesh))
+	{
+		return false;
+	}
+
+	for (const int32 Count : InteractableCounts)
+	{
+		FTFTestWorld TestWorld;
+		UWorld* World = TestWorld.Get();
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			const FTransform Transform(GetGridLocation(Index, Count));
+			ATFInteractableActor* Interactable = World->SpawnActorDeferred<ATFInteractableActor>(ATFInteractableActor::StaticClass(), Transform);
+			Interactable->GetMeshComponent()->SetStaticMesh(CubeMesh);
+			Interactable->FinishSpawning(Transform);
+		}
+
+		const UTFInteractableGridSubsystem* Grid = UTFInteractableGridSubsystem::Get(World);
+		if (!TestNotNull(TEXT("Interactable grid"), Grid))
+		{
+			return false;
+		}
+
+		TestEqual(FString::Printf(TEXT("%d interactables registered"), Count), Grid->GetNumInteractables(), Count);
+
+		const FVector FieldExtent = GetGridLocation(Count - 1, Count);
+		FRandomStream Random(Count);
+
+		TArray<FVector> QueryPoints;
+		QueryPoints.Reserve(QueriesPerIteration);
+		for (int32 Query = 0; Query < QueriesPerIteration; ++Query)
+		{
+			QueryPoints.Emplace(Random.FRandRange(0.0f, FieldExtent.X), Random.FRandRange(-DetectionDistance, FieldExtent.Y), 50.0f);
+		}
+
+		// The cheap gate detection runs before every trace
+		int32 NumNear = 0;
+		Report.Measure(FString::Printf(TEXT("GridQuery_%d"), Count), 20, [&]
+		{
+			NumNear = 0;
+			for (const FVector& Point : QueryPoints)
+			{
+				NumNear += Grid->HasInteractableNear(Point, DetectionDistance) ? 1 : 0;
+			}
+		});
+
+		// The detection trace itself, straight ahead along +Y into the field
+		int32 NumHits = 0;
+		const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TFPerfInteractionTrace), false);
+		Report.Measure(FString::Printf(TEXT("Trace_%d"), Count), 20, [&]
+		{
+			NumHits = 0;
+			for (const FVector& Point : QueryPoints)
+			{
+				FHitResult Hit;
+				NumHits += World->LineTraceSingleByChannel(Hit, Point, Point + FVector(0.0f, DetectionDistance, 0.0f), ECC_Visibility, QueryParams) ? 1 : 0;
+			}
+		});
+
+		TestTrue(FString::Printf(TEXT("Grid finds interactables among %d"), Count), NumNear > 0);
+		TestTrue(FString::Printf(TEXT("Traces hit interactables among %d"), Count), NumHits > 0);
+	}
+
+	return Report.Finish();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
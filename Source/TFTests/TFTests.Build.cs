@@ -0,0 +1,36 @@
+// Copyright TF Project. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class TFTests : ModuleRules
+{
+	public TFTests (ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core"
+			}
+			);
+
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"CoreUObject",
+				"Engine",
+				"Json",
+				"UMG",
+				"Interfaces",
+				"Components",
+				"Inventory",
+				"TFWorldActors",
+				"Widgets"
+			}
+			);
+
+	}
+}
@@ -7,7 +7,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
-#include "Misc/ConfigCacheIni.h"
+#include "TFConfigSubsystem.h"
 
 ATFBaseContainerActor::ATFBaseContainerActor()
 {
@@ -39,30 +39,40 @@ void ATFBaseContainerActor::LoadConfigFromINI()
 		return;
 	}
 
-	const FString SectionName = InteractableID.ToString();
-	FString ConfigFilePath;
+	const UTFConfigSubsystem* ConfigSubsystem = UTFConfigSubsystem::Get(this);
+	const FTFContainerConfig* Config = ConfigSubsystem ? ConfigSubsystem->FindContainerConfig(InteractableID) : nullptr;
 
-	if (!TFConfigUtils::LoadINISection(TEXT("ContainerConfig.ini"), SectionName, ConfigFilePath, LogTFContainer))
+	if (!Config)
 	{
+		UE_LOG(LogTFContainer, Warning, TEXT("ATFBaseContainerActor: Section [%s] not found in ContainerConfig.ini"), *InteractableID.ToString());
 		return;
 	}
 
-	UE_LOG(LogTFContainer, Log, TEXT("ATFBaseContainerActor: Loading container config for '%s'"), *SectionName);
+	UE_LOG(LogTFContainer, Log, TEXT("ATFBaseContainerActor: Loading container config for '%s'"), *InteractableID.ToString());
 
-#pragma region Container Settings
+	ApplyContainerConfig(*Config);
 
-	GConfig->GetInt(*SectionName, TEXT("MaxCapacity"), MaxCapacity, ConfigFilePath);
-	MaxCapacity = FMath::Max(1, MaxCapacity);
+	UE_LOG(LogTFContainer, Log, TEXT("ATFBaseContainerActor: Config loaded (MaxCapacity: %d, Name: '%s')"), MaxCapacity, *ContainerDisplayName.ToString());
+}
 
-	FString ContainerNameStr;
-	if (GConfig->GetString(*SectionName, TEXT("ContainerName"), ContainerNameStr, ConfigFilePath) && !ContainerNameStr.IsEmpty())
-	{
-		ContainerDisplayName = FText::FromString(ContainerNameStr);
-	}
+void ATFBaseContainerActor::ApplyContainerConfig(const FTFContainerConfig& Config)
+{
+#pragma region Container Settings
+
+	MaxCapacity = FMath::Max(1, Config.MaxCapacity.Get(MaxCapacity));
+	ContainerDisplayName = Config.ContainerName.Get(ContainerDisplayName);
 
 #pragma endregion Container Settings
+}
 
-	UE_LOG(LogTFContainer, Log, TEXT("ATFBaseContainerActor: Config loaded (MaxCapacity: %d, Name: '%s')"), MaxCapacity, *ContainerDisplayName.ToString());
+void ATFBaseContainerActor::OnConfigReloaded(const FTFConfigDelta& Delta)
+{
+	Super::OnConfigReloaded(Delta);
+
+	if (Delta.Container)
+	{
+		ApplyContainerConfig(*Delta.Container);
+	}
 }
 
 void ATFBaseContainerActor::OnInteracted(APawn* InstigatorPawn)
@@ -125,15 +135,15 @@ bool ATFBaseContainerActor::AddItemToContainer(const FItemData& Item)
 {
 	if (!ContainerHasSpace())
 	{
-		UE_LOG(LogTFContainer, Warning, TEXT("ATFBaseContainerActor: Cannot add item '%s' - container full (%d/%d)"),
-			*Item.ItemName.ToString(), GetContainerUsedSlots(), MaxCapacity);
+		UE_LOGFMT(LogTFContainer, Warning, "ATFBaseContainerActor: Cannot add item '{ItemID}' - container full ({Used}/{Capacity})",
+			Item.ItemID, GetContainerUsedSlots(), MaxCapacity);
 		return false;
 	}
 
 	ContainerItems.Add(Item);
 
-	UE_LOG(LogTFContainer, Log, TEXT("ATFBaseContainerActor: Added item '%s' (%d/%d slots used)"),
-		*Item.ItemName.ToString(), GetContainerUsedSlots(), MaxCapacity);
+	UE_LOGFMT(LogTFContainer, Verbose, "ATFBaseContainerActor: Added item '{ItemID}' ({Used}/{Capacity} slots used)",
+		Item.ItemID, GetContainerUsedSlots(), MaxCapacity);
 
 	OnContainerContentChanged.Broadcast();
 
@@ -153,8 +163,8 @@ bool ATFBaseContainerActor::RemoveItemFromContainer(FName ItemID)
 		{
 			ContainerItems.RemoveAt(i);
 
-			UE_LOG(LogTFContainer, Log, TEXT("ATFBaseContainerActor: Removed item '%s' (%d/%d slots used)"),
-				*ItemID.ToString(), GetContainerUsedSlots(), MaxCapacity);
+			UE_LOGFMT(LogTFContainer, Verbose, "ATFBaseContainerActor: Removed item '{ItemID}' ({Used}/{Capacity} slots used)",
+				ItemID, GetContainerUsedSlots(), MaxCapacity);
 
 			OnContainerContentChanged.Broadcast();
 			return true;
@@ -164,6 +174,73 @@ bool ATFBaseContainerActor::RemoveItemFromContainer(FName ItemID)
 	return false;
 }
 
+bool ATFBaseContainerActor::AddItemsToContainer(TConstArrayView<FItemData> NewItems)
+{
+	if (NewItems.Num() == 0)
+	{
+		return true;
+	}
+
+	if (NewItems.Num() > GetContainerFreeSlots())
+	{
+		UE_LOGFMT(LogTFContainer, Warning, "ATFBaseContainerActor: Cannot add {Count} items - only {Free} slots free",
+			NewItems.Num(), GetContainerFreeSlots());
+		return false;
+	}
+
+	ContainerItems.Append(NewItems.GetData(), NewItems.Num());
+
+	UE_LOGFMT(LogTFContainer, Verbose, "ATFBaseContainerActor: Added {Count} items ({Used}/{Capacity} slots used)",
+		NewItems.Num(), GetContainerUsedSlots(), MaxCapacity);
+
+	OnContainerContentChanged.Broadcast();
+
+	return true;
+}
+
+int32 ATFBaseContainerActor::RemoveContainerItemsAt(TConstArrayView<int32> Indices, TArray<FItemData>& OutRemoved)
+{
+	TBitArray<> RemoveMask(false, ContainerItems.Num());
+	int32 NumRemoved = 0;
+
+	for (const int32 Index : Indices)
+	{
+		if (ContainerItems.IsValidIndex(Index) && !RemoveMask[Index])
+		{
+			RemoveMask[Index] = true;
+			OutRemoved.Add(ContainerItems[Index]);
+			++NumRemoved;
+		}
+	}
+
+	if (NumRemoved == 0)
+	{
+		return 0;
+	}
+
+	// Single compaction pass keeps the remaining items in order
+	int32 WriteIndex = 0;
+	for (int32 ReadIndex = 0; ReadIndex < ContainerItems.Num(); ++ReadIndex)
+	{
+		if (!RemoveMask[ReadIndex])
+		{
+			if (WriteIndex != ReadIndex)
+			{
+				ContainerItems[WriteIndex] = MoveTemp(ContainerItems[ReadIndex]);
+			}
+			++WriteIndex;
+		}
+	}
+	ContainerItems.SetNum(WriteIndex, EAllowShrinking::No);
+
+	UE_LOGFMT(LogTFContainer, Verbose, "ATFBaseContainerActor: Removed {Count} items ({Used}/{Capacity} slots used)",
+		NumRemoved, GetContainerUsedSlots(), MaxCapacity);
+
+	OnContainerContentChanged.Broadcast();
+
+	return NumRemoved;
+}
+
 const FItemData* ATFBaseContainerActor::GetContainerItem(FName ItemID) const
 {
 	for (const FItemData& Item : ContainerItems)
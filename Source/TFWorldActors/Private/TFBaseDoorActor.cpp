@@ -4,12 +4,13 @@
 #include "TFTypes.h"
 #include "Components/AudioComponent.h"
 #include "Components/StaticMeshComponent.h"
-#include "Misc/ConfigCacheIni.h"
+#include "TFConfigSubsystem.h"
+#include "TFDoorAnimationSubsystem.h"
 
 ATFBaseDoorActor::ATFBaseDoorActor()
 {
-	PrimaryActorTick.bCanEverTick = true;
-	PrimaryActorTick.bStartWithTickEnabled = false;
+	// Animated by UTFDoorAnimationSubsystem
+	PrimaryActorTick.bCanEverTick = false;
 
 	MeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
 	MeshComponent->SetCollisionResponseToAllChannels(ECR_Block);
@@ -49,47 +50,44 @@ void ATFBaseDoorActor::LoadConfigFromINI()
 		return;
 	}
 
-	const FString SectionName = InteractableID.ToString();
-	FString ConfigFilePath;
+	const UTFConfigSubsystem* ConfigSubsystem = UTFConfigSubsystem::Get(this);
+	const FTFDoorConfig* Config = ConfigSubsystem ? ConfigSubsystem->FindDoorConfig(InteractableID) : nullptr;
 
-	if (!TFConfigUtils::LoadINISection(TEXT("DoorConfig.ini"), SectionName, ConfigFilePath, LogTFDoor))
+	if (!Config)
 	{
+		UE_LOG(LogTFDoor, Warning, TEXT("ATFBaseDoorActor: Section [%s] not found in DoorConfig.ini"), *InteractableID.ToString());
 		return;
 	}
 
-	UE_LOG(LogTFDoor, Log, TEXT("ATFBaseDoorActor: Loading config for InteractableID '%s'"), *SectionName);
+	UE_LOG(LogTFDoor, Log, TEXT("ATFBaseDoorActor: Loading config for InteractableID '%s'"), *InteractableID.ToString());
 
-#pragma region Door Settings
+	ApplyDoorConfig(*Config);
 
-	FString StringValue;
-	if (GConfig->GetString(*SectionName, TEXT("HingeType"), StringValue, ConfigFilePath))
-	{
-		static const TMap<FString, EDoorHinge> HingeMap = {
-			{TEXT("Left"), EDoorHinge::Left},
-			{TEXT("Right"), EDoorHinge::Right}
-		};
-
-		bool bMatched = false;
-		HingeType = TFConfigUtils::StringToEnum(StringValue, HingeMap, EDoorHinge::Left, &bMatched);
-		if (!bMatched)
-		{
-			UE_LOG(LogTFDoor, Warning, TEXT("ATFBaseDoorActor: Unknown HingeType '%s', defaulting to Left"), *StringValue);
-		}
-	}
+	UE_LOG(LogTFDoor, Log, TEXT("ATFBaseDoorActor: Config loaded successfully for InteractableID '%s'"), *InteractableID.ToString());
+}
 
-	GConfig->GetFloat(*SectionName, TEXT("MaxOpenAngle"), MaxOpenAngle, ConfigFilePath);
-	GConfig->GetFloat(*SectionName, TEXT("OpenDuration"), OpenDuration, ConfigFilePath);
-	GConfig->GetFloat(*SectionName, TEXT("CloseDuration"), CloseDuration, ConfigFilePath);
-	GConfig->GetBool(*SectionName, TEXT("bAutoClose"), bAutoClose, ConfigFilePath);
-	GConfig->GetFloat(*SectionName, TEXT("AutoCloseDelay"), AutoCloseDelay, ConfigFilePath);
-	MaxOpenAngle = FMath::Clamp(MaxOpenAngle, 0.0f, 180.0f);
-	OpenDuration = FMath::Clamp(OpenDuration, 0.1f, 5.0f);
-	CloseDuration = FMath::Clamp(CloseDuration, 0.1f, 5.0f);
-	AutoCloseDelay = FMath::Max(AutoCloseDelay, 0.0f);
+void ATFBaseDoorActor::ApplyDoorConfig(const FTFDoorConfig& Config)
+{
+#pragma region Door Settings
+
+	HingeType = Config.HingeType.Get(HingeType);
+	MaxOpenAngle = FMath::Clamp(Config.MaxOpenAngle.Get(MaxOpenAngle), 0.0f, 180.0f);
+	OpenDuration = FMath::Clamp(Config.OpenDuration.Get(OpenDuration), 0.1f, 5.0f);
+	CloseDuration = FMath::Clamp(Config.CloseDuration.Get(CloseDuration), 0.1f, 5.0f);
+	bAutoClose = Config.bAutoClose.Get(bAutoClose);
+	AutoCloseDelay = FMath::Max(Config.AutoCloseDelay.Get(AutoCloseDelay), 0.0f);
 
 #pragma endregion Door Settings
+}
 
-	UE_LOG(LogTFDoor, Log, TEXT("ATFBaseDoorActor: Config loaded successfully for InteractableID '%s'"), *SectionName);
+void ATFBaseDoorActor::OnConfigReloaded(const FTFConfigDelta& Delta)
+{
+	Super::OnConfigReloaded(Delta);
+
+	if (Delta.Door)
+	{
+		ApplyDoorConfig(*Delta.Door);
+	}
 }
 
 void ATFBaseDoorActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -97,51 +95,46 @@ void ATFBaseDoorActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(AutoCloseTimerHandle);
+
+		if (UTFDoorAnimationSubsystem* Animation = World->GetSubsystem<UTFDoorAnimationSubsystem>())
+		{
+			Animation->StopAnimation(this);
+		}
 	}
 
 	Super::EndPlay(EndPlayReason);
 }
 
-void ATFBaseDoorActor::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	if (IsMoving())
-	{
-		UpdateDoorAnimation(DeltaTime);
-	}
-}
-
-void ATFBaseDoorActor::UpdateDoorAnimation(float DeltaTime)
+void ATFBaseDoorActor::StartDoorAnimation(float StartAngle, float EndAngle, float Duration)
 {
-	if (CurrentAnimationDuration <= 0.0f)
+	UWorld* World = GetWorld();
+	UTFDoorAnimationSubsystem* Animation = World ? World->GetSubsystem<UTFDoorAnimationSubsystem>() : nullptr;
+	if (!Animation)
 	{
+		// No animation subsystem (e.g. editor preview): snap to the end state
+		SetAnimatedAngle(EndAngle);
+		FinishDoorAnimation();
 		return;
 	}
 
-	AnimationTimer += DeltaTime;
-	float Alpha = FMath::Clamp(AnimationTimer / CurrentAnimationDuration, 0.0f, 1.0f);
-
-	float EasedAlpha = Alpha * Alpha * (3.0f - 2.0f * Alpha);
-
-	CurrentAngle = FMath::Lerp(
-		DoorState == EDoorState::Opening ? 0.0f : TargetAngle,
-		DoorState == EDoorState::Opening ? TargetAngle : 0.0f,
-		EasedAlpha
-	);
+	Animation->StartAnimation(this, StartAngle, EndAngle, Duration);
+}
 
+void ATFBaseDoorActor::SetAnimatedAngle(float Angle)
+{
+	CurrentAngle = Angle;
 	ApplyDoorRotation(CurrentAngle);
+}
 
-	if (Alpha >= 1.0f)
+void ATFBaseDoorActor::FinishDoorAnimation()
+{
+	if (DoorState == EDoorState::Opening)
 	{
-		if (DoorState == EDoorState::Opening)
-		{
-			CompleteOpening();
-		}
-		else if (DoorState == EDoorState::Closing)
-		{
-			CompleteClosing();
-		}
+		CompleteOpening();
+	}
+	else if (DoorState == EDoorState::Closing)
+	{
+		CompleteClosing();
 	}
 }
 
@@ -186,24 +179,18 @@ void ATFBaseDoorActor::StartOpening(APawn* OpeningCharacter)
 	}
 
 	DoorState = EDoorState::Opening;
-	AnimationTimer = 0.0f;
-	CurrentAnimationDuration = OpenDuration;
-
-	SetActorTickEnabled(true);
 
 	PlayDoorSound(DoorOpenSound);
 	PlayDoorMovementSound();
 
 	OnDoorStartOpening(OpeningCharacter);
+
+	StartDoorAnimation(0.0f, TargetAngle, OpenDuration);
 }
 
 void ATFBaseDoorActor::StartClosing()
 {
 	DoorState = EDoorState::Closing;
-	AnimationTimer = 0.0f;
-	CurrentAnimationDuration = CloseDuration;
-
-	SetActorTickEnabled(true);
 
 	if (UWorld* World = GetWorld())
 	{
@@ -214,6 +201,8 @@ void ATFBaseDoorActor::StartClosing()
 	PlayDoorMovementSound();
 
 	OnDoorStartClosing();
+
+	StartDoorAnimation(TargetAngle, 0.0f, CloseDuration);
 }
 
 void ATFBaseDoorActor::CompleteOpening()
@@ -221,7 +210,6 @@ void ATFBaseDoorActor::CompleteOpening()
 	DoorState = EDoorState::Open;
 	CurrentAngle = TargetAngle;
 
-	SetActorTickEnabled(false);
 	StopDoorMovementSound();
 
 	if (bAutoClose)
@@ -250,7 +238,6 @@ void ATFBaseDoorActor::CompleteClosing()
 	DoorState = EDoorState::Closed;
 	CurrentAngle = 0.0f;
 
-	SetActorTickEnabled(false);
 	StopDoorMovementSound();
 
 	OnDoorClosed();
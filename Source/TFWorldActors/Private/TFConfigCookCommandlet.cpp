@@ -0,0 +1,43 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFConfigCookCommandlet.h"
+#include "TFConfigSubsystem.h"
+#include "TFTypes.h"
+
+UTFConfigCookCommandlet::UTFConfigCookCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UTFConfigCookCommandlet::Main(const FString& Params)
+{
+	FString OutputPath = UTFConfigSubsystem::GetCookedConfigPath();
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	// Packaging step: fail instead of staging a blob that no longer matches the INI files
+	if (FParse::Param(*Params, TEXT("Verify")))
+	{
+		if (!UTFConfigSubsystem::IsCookedConfigCurrent(OutputPath))
+		{
+			UE_LOG(LogTFConfig, Error, TEXT("UTFConfigCookCommandlet: %s is missing or older than the INI files; re-run -run=TFConfigCook"), *OutputPath);
+			return 1;
+		}
+
+		UE_LOG(LogTFConfig, Display, TEXT("UTFConfigCookCommandlet: %s matches the INI files"), *OutputPath);
+		return 0;
+	}
+
+	// Parse through a standalone instance; no game instance exists in a commandlet
+	UTFConfigSubsystem* ConfigSubsystem = NewObject<UTFConfigSubsystem>(GetTransientPackage());
+
+	if (!ConfigSubsystem->ParseINIFiles())
+	{
+		UE_LOG(LogTFConfig, Error, TEXT("UTFConfigCookCommandlet: %d validation errors, not writing %s"), ConfigSubsystem->GetNumParseErrors(), *OutputPath);
+		return 1;
+	}
+
+	return ConfigSubsystem->SaveCookedConfigs(OutputPath) ? 0 : 1;
+}
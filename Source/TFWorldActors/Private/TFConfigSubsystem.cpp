@@ -0,0 +1,721 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFConfigSubsystem.h"
+#include "TFTypes.h"
+#include "TFStats.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/NameAsStringProxyArchive.h"
+
+#if WITH_EDITOR
+#include "TFInteractableActor.h"
+#include "DirectoryWatcherModule.h"
+#include "EngineUtils.h"
+#include "IDirectoryWatcher.h"
+#include "Modules/ModuleManager.h"
+#endif
+
+namespace
+{
+	TOptional<float> ReadFloat(const FString& SectionName, const TCHAR* Key, const FString& ConfigFilePath)
+	{
+		float Value = 0.0f;
+		return GConfig->GetFloat(*SectionName, Key, Value, ConfigFilePath) ? TOptional<float>(Value) : TOptional<float>();
+	}
+
+	TOptional<int32> ReadInt(const FString& SectionName, const TCHAR* Key, const FString& ConfigFilePath)
+	{
+		int32 Value = 0;
+		return GConfig->GetInt(*SectionName, Key, Value, ConfigFilePath) ? TOptional<int32>(Value) : TOptional<int32>();
+	}
+
+	TOptional<bool> ReadBool(const FString& SectionName, const TCHAR* Key, const FString& ConfigFilePath)
+	{
+		bool bValue = false;
+		return GConfig->GetBool(*SectionName, Key, bValue, ConfigFilePath) ? TOptional<bool>(bValue) : TOptional<bool>();
+	}
+
+	TOptional<FString> ReadString(const FString& SectionName, const TCHAR* Key, const FString& ConfigFilePath)
+	{
+		FString Value;
+		return GConfig->GetString(*SectionName, Key, Value, ConfigFilePath) ? TOptional<FString>(MoveTemp(Value)) : TOptional<FString>();
+	}
+
+	/** 'TFCF'; bump CookedConfigVersion whenever a config struct or the header changes */
+	constexpr uint32 CookedConfigMagic = 0x46434654;
+	constexpr uint32 CookedConfigVersion = 3;
+
+	/** Source files baked into the cooked blob */
+	const TCHAR* const CookedConfigSources[] = {
+		TEXT("InteractableConfig.ini"),
+		TEXT("ItemConfig.ini"),
+		TEXT("DoorConfig.ini"),
+		TEXT("ContainerConfig.ini")
+	};
+
+	/** Size and modification time of one source INI file; a stat, never a read */
+	struct FConfigSourceStamp
+	{
+		int64 Size = INDEX_NONE;
+		int64 ModifiedTicks = 0;
+
+		bool operator==(const FConfigSourceStamp& Other) const { return Size == Other.Size && ModifiedTicks == Other.ModifiedTicks; }
+
+		friend FArchive& operator<<(FArchive& Ar, FConfigSourceStamp& Stamp)
+		{
+			return Ar << Stamp.Size << Stamp.ModifiedTicks;
+		}
+	};
+
+	using FConfigSourceStamps = TArray<FConfigSourceStamp, TFixedAllocator<UE_ARRAY_COUNT(CookedConfigSources)>>;
+
+	/** Stamps every source INI file; false when none are present (e.g. stripped from the build) */
+	bool StampConfigSources(FConfigSourceStamps& OutStamps)
+	{
+		OutStamps.Reset();
+		bool bFoundAny = false;
+
+		for (const TCHAR* FileName : CookedConfigSources)
+		{
+			const FFileStatData StatData = IFileManager::Get().GetStatData(*TFConfigUtils::GetConfigFilePath(FileName));
+			FConfigSourceStamp& Stamp = OutStamps.AddDefaulted_GetRef();
+			if (StatData.bIsValid)
+			{
+				Stamp.Size = StatData.FileSize;
+				Stamp.ModifiedTicks = StatData.ModificationTime.GetTicks();
+				bFoundAny = true;
+			}
+		}
+
+		return bFoundAny;
+	}
+
+	/** Reads the blob header; false if it is not a blob of the current version */
+	bool SerializeCookedHeader(FArchive& Ar, FConfigSourceStamps& Stamps)
+	{
+		uint32 Magic = CookedConfigMagic;
+		uint32 Version = CookedConfigVersion;
+		Ar << Magic << Version;
+
+		if (Magic != CookedConfigMagic || Version != CookedConfigVersion)
+		{
+			return false;
+		}
+
+		int32 NumStamps = Stamps.Num();
+		Ar << NumStamps;
+		if (Ar.IsLoading())
+		{
+			if (NumStamps != UE_ARRAY_COUNT(CookedConfigSources))
+			{
+				return false;
+			}
+			Stamps.SetNum(NumStamps);
+		}
+
+		for (FConfigSourceStamp& Stamp : Stamps)
+		{
+			Ar << Stamp;
+		}
+
+		return !Ar.IsError();
+	}
+
+	/** True if an INI file changed since the stamps were taken; false when the INI files are not present to compare */
+	bool AreConfigSourcesNewer(const FConfigSourceStamps& CookedStamps)
+	{
+		FConfigSourceStamps CurrentStamps;
+		return StampConfigSources(CurrentStamps) && CurrentStamps != CookedStamps;
+	}
+
+	void SerializeConfig(FArchive& Ar, FTFInteractableConfig& Config)
+	{
+		Ar << Config.MaxInteractionDistance << Config.bCanInteract;
+	}
+
+	void SerializeConfig(FArchive& Ar, FTFItemConfig& Config)
+	{
+		Ar << Config.ItemType << Config.ItemName << Config.ItemDescription << Config.Weight;
+		Ar << Config.HungerRestore << Config.ThirstRestore << Config.BackpackSlots << Config.BackpackWeightLimit;
+		Ar << Config.bDestroyOnPickup << Config.DestroyDelay << Config.MaxInteractionDistance;
+
+		FString MeshPath = Config.ItemMesh.ToString();
+		Ar << MeshPath;
+		if (Ar.IsLoading())
+		{
+			Config.ItemMesh = MeshPath.IsEmpty() ? TSoftObjectPtr<UStaticMesh>() : TSoftObjectPtr<UStaticMesh>(FSoftObjectPath(MeshPath));
+		}
+	}
+
+	void SerializeConfig(FArchive& Ar, FTFDoorConfig& Config)
+	{
+		Ar << Config.HingeType << Config.MaxOpenAngle << Config.OpenDuration << Config.CloseDuration;
+		Ar << Config.bAutoClose << Config.AutoCloseDelay;
+	}
+
+	void SerializeConfig(FArchive& Ar, FTFContainerConfig& Config)
+	{
+		Ar << Config.MaxCapacity << Config.ContainerName;
+	}
+
+	template <typename ConfigType>
+	void SerializeTable(FArchive& Ar, TMap<FName, ConfigType>& Table)
+	{
+		int32 Num = Table.Num();
+		Ar << Num;
+
+		if (Ar.IsLoading())
+		{
+			Table.Empty(Num);
+			for (int32 i = 0; i < Num && !Ar.IsError(); ++i)
+			{
+				FName Key;
+				Ar << Key;
+				SerializeConfig(Ar, Table.Add(Key));
+			}
+			return;
+		}
+
+		for (TPair<FName, ConfigType>& Pair : Table)
+		{
+			Ar << Pair.Key;
+			SerializeConfig(Ar, Pair.Value);
+		}
+	}
+
+#if WITH_EDITOR
+	template <typename T>
+	void ClearIfUnchanged(TOptional<T>& NewValue, const TOptional<T>& OldValue)
+	{
+		if (NewValue == OldValue)
+		{
+			NewValue.Reset();
+		}
+	}
+
+	void ClearIfUnchanged(TOptional<FText>& NewValue, const TOptional<FText>& OldValue)
+	{
+		if (NewValue.IsSet() == OldValue.IsSet() && (!NewValue.IsSet() || NewValue->ToString().Equals(OldValue->ToString(), ESearchCase::CaseSensitive)))
+		{
+			NewValue.Reset();
+		}
+	}
+
+	/** Strips fields equal to Old from New; returns true if anything changed */
+	bool MakeDelta(FTFInteractableConfig& New, const FTFInteractableConfig& Old)
+	{
+		ClearIfUnchanged(New.MaxInteractionDistance, Old.MaxInteractionDistance);
+		ClearIfUnchanged(New.bCanInteract, Old.bCanInteract);
+
+		return New.MaxInteractionDistance.IsSet() || New.bCanInteract.IsSet();
+	}
+
+	bool MakeDelta(FTFItemConfig& New, const FTFItemConfig& Old)
+	{
+		ClearIfUnchanged(New.ItemType, Old.ItemType);
+		ClearIfUnchanged(New.ItemName, Old.ItemName);
+		ClearIfUnchanged(New.ItemDescription, Old.ItemDescription);
+		ClearIfUnchanged(New.Weight, Old.Weight);
+		ClearIfUnchanged(New.HungerRestore, Old.HungerRestore);
+		ClearIfUnchanged(New.ThirstRestore, Old.ThirstRestore);
+		ClearIfUnchanged(New.BackpackSlots, Old.BackpackSlots);
+		ClearIfUnchanged(New.BackpackWeightLimit, Old.BackpackWeightLimit);
+		ClearIfUnchanged(New.bDestroyOnPickup, Old.bDestroyOnPickup);
+		ClearIfUnchanged(New.DestroyDelay, Old.DestroyDelay);
+		ClearIfUnchanged(New.MaxInteractionDistance, Old.MaxInteractionDistance);
+
+		if (New.ItemMesh == Old.ItemMesh)
+		{
+			New.ItemMesh.Reset();
+		}
+
+		return New.ItemType.IsSet() || New.ItemName.IsSet() || New.ItemDescription.IsSet() || New.Weight.IsSet()
+			|| New.HungerRestore.IsSet() || New.ThirstRestore.IsSet() || New.BackpackSlots.IsSet() || New.BackpackWeightLimit.IsSet()
+			|| New.bDestroyOnPickup.IsSet() || New.DestroyDelay.IsSet() || New.MaxInteractionDistance.IsSet() || !New.ItemMesh.IsNull();
+	}
+
+	bool MakeDelta(FTFDoorConfig& New, const FTFDoorConfig& Old)
+	{
+		ClearIfUnchanged(New.HingeType, Old.HingeType);
+		ClearIfUnchanged(New.MaxOpenAngle, Old.MaxOpenAngle);
+		ClearIfUnchanged(New.OpenDuration, Old.OpenDuration);
+		ClearIfUnchanged(New.CloseDuration, Old.CloseDuration);
+		ClearIfUnchanged(New.bAutoClose, Old.bAutoClose);
+		ClearIfUnchanged(New.AutoCloseDelay, Old.AutoCloseDelay);
+
+		return New.HingeType.IsSet() || New.MaxOpenAngle.IsSet() || New.OpenDuration.IsSet()
+			|| New.CloseDuration.IsSet() || New.bAutoClose.IsSet() || New.AutoCloseDelay.IsSet();
+	}
+
+	bool MakeDelta(FTFContainerConfig& New, const FTFContainerConfig& Old)
+	{
+		ClearIfUnchanged(New.MaxCapacity, Old.MaxCapacity);
+		ClearIfUnchanged(New.ContainerName, Old.ContainerName);
+
+		return New.MaxCapacity.IsSet() || New.ContainerName.IsSet();
+	}
+#endif
+}
+
+void UTFConfigSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// The editor always parses the INI files so edits apply without re-cooking
+#if WITH_EDITOR
+	const bool bLoadedCooked = false;
+#else
+	const bool bLoadedCooked = LoadCookedConfigs(GetCookedConfigPath());
+#endif
+
+	if (!bLoadedCooked)
+	{
+		ParseINIFiles();
+	}
+
+#if WITH_EDITOR
+	StartConfigWatcher();
+#endif
+
+	UE_LOG(LogTFConfig, Log, TEXT("UTFConfigSubsystem: Loaded %d interactable, %d item, %d door, %d container definitions from %s in %.2f ms"),
+		InteractableConfigs.Num(), ItemConfigs.Num(), DoorConfigs.Num(), ContainerConfigs.Num(),
+		bLoadedCooked ? TEXT("cooked blob") : TEXT("INI files"),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void UTFConfigSubsystem::Deinitialize()
+{
+#if WITH_EDITOR
+	StopConfigWatcher();
+#endif
+
+	InteractableConfigs.Empty();
+	ItemConfigs.Empty();
+	DoorConfigs.Empty();
+	ContainerConfigs.Empty();
+	ItemDefinitions.Empty();
+	ItemDefinitionIndex.Empty();
+
+	Super::Deinitialize();
+}
+
+UTFConfigSubsystem* UTFConfigSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UTFConfigSubsystem>() : nullptr;
+}
+
+const UTFItemDefinition* UTFConfigSubsystem::InternItemDefinition(const FItemDefinition& Definition)
+{
+	for (auto It = ItemDefinitionIndex.CreateConstKeyIterator(Definition.ItemID); It; ++It)
+	{
+		if (It.Value()->Get().IsEquivalent(Definition))
+		{
+			return It.Value();
+		}
+	}
+
+	UTFItemDefinition* NewDefinition = UTFItemDefinition::Create(Definition, this);
+	ItemDefinitions.Add(NewDefinition);
+	ItemDefinitionIndex.Add(Definition.ItemID, NewDefinition);
+
+	return NewDefinition;
+}
+
+#pragma region Cooked Config
+
+FString UTFConfigSubsystem::GetCookedConfigPath()
+{
+	return FPaths::ProjectContentDir() / TEXT("Data/TFConfig.bin");
+}
+
+bool UTFConfigSubsystem::ParseINIFiles()
+{
+	TF_SCOPE_CYCLE_COUNTER(ConfigLoad);
+
+	NumParseErrors = 0;
+	InteractableConfigs.Empty();
+	ItemConfigs.Empty();
+	DoorConfigs.Empty();
+	ContainerConfigs.Empty();
+
+	LoadInteractableConfigs();
+	LoadItemConfigs();
+	LoadDoorConfigs();
+	LoadContainerConfigs();
+
+	SET_DWORD_STAT(STAT_TFConfigEntries, InteractableConfigs.Num() + ItemConfigs.Num() + DoorConfigs.Num() + ContainerConfigs.Num());
+
+	return NumParseErrors == 0;
+}
+
+void UTFConfigSubsystem::SerializeTables(FArchive& Ar)
+{
+	SerializeTable(Ar, InteractableConfigs);
+	SerializeTable(Ar, ItemConfigs);
+	SerializeTable(Ar, DoorConfigs);
+	SerializeTable(Ar, ContainerConfigs);
+}
+
+bool UTFConfigSubsystem::SaveCookedConfigs(const FString& FilePath)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes, true);
+	FNameAsStringProxyArchive Ar(Writer);
+
+	FConfigSourceStamps Stamps;
+	StampConfigSources(Stamps);
+
+	SerializeCookedHeader(Ar, Stamps);
+	SerializeTables(Ar);
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *FilePath))
+	{
+		UE_LOG(LogTFConfig, Error, TEXT("UTFConfigSubsystem: Failed to write cooked config to %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogTFConfig, Log, TEXT("UTFConfigSubsystem: Wrote cooked config (%d bytes) to %s"), Bytes.Num(), *FilePath);
+	return true;
+}
+
+bool UTFConfigSubsystem::IsCookedConfigCurrent(const FString& FilePath)
+{
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*FilePath, FILEREAD_Silent));
+	if (!FileReader)
+	{
+		return false;
+	}
+
+	FConfigSourceStamps Stamps;
+	return SerializeCookedHeader(*FileReader, Stamps) && !AreConfigSourcesNewer(Stamps);
+}
+
+bool UTFConfigSubsystem::LoadCookedConfigs(const FString& FilePath)
+{
+	TF_SCOPE_CYCLE_COUNTER(ConfigLoad);
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes, true);
+	FNameAsStringProxyArchive Ar(Reader);
+
+	FConfigSourceStamps Stamps;
+	if (!SerializeCookedHeader(Ar, Stamps))
+	{
+		UE_LOG(LogTFConfig, Warning, TEXT("UTFConfigSubsystem: Ignoring cooked config %s (not a version %u blob), falling back to INI files"), *FilePath, CookedConfigVersion);
+		return false;
+	}
+
+#if !UE_BUILD_SHIPPING
+	// Packaging verifies the blob with -run=TFConfigCook -Verify; this stat-only check catches INI edits in development
+	if (AreConfigSourcesNewer(Stamps))
+	{
+		UE_LOG(LogTFConfig, Warning, TEXT("UTFConfigSubsystem: Cooked config %s is older than the INI files, falling back to INI files; re-run -run=TFConfigCook"), *FilePath);
+		return false;
+	}
+#endif
+
+	SerializeTables(Ar);
+
+	if (Ar.IsError())
+	{
+		UE_LOG(LogTFConfig, Warning, TEXT("UTFConfigSubsystem: Cooked config %s is truncated, falling back to INI files"), *FilePath);
+		InteractableConfigs.Empty();
+		ItemConfigs.Empty();
+		DoorConfigs.Empty();
+		ContainerConfigs.Empty();
+		return false;
+	}
+
+	SET_DWORD_STAT(STAT_TFConfigEntries, InteractableConfigs.Num() + ItemConfigs.Num() + DoorConfigs.Num() + ContainerConfigs.Num());
+
+	return true;
+}
+
+#pragma endregion Cooked Config
+
+#if WITH_EDITOR
+#pragma region Hot Reload
+
+void UTFConfigSubsystem::StartConfigWatcher()
+{
+	// Standalone instances (e.g. the cook commandlet) have no game to update
+	if (!GetGameInstance())
+	{
+		return;
+	}
+
+	FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get())
+	{
+		DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+			FPaths::ConvertRelativePathToFull(FPaths::ProjectConfigDir()),
+			IDirectoryWatcher::FDirectoryChanged::CreateUObject(this, &UTFConfigSubsystem::OnConfigDirectoryChanged),
+			ConfigWatcherHandle
+		);
+	}
+}
+
+void UTFConfigSubsystem::StopConfigWatcher()
+{
+	if (!ConfigWatcherHandle.IsValid())
+	{
+		return;
+	}
+
+	if (FDirectoryWatcherModule* DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+	{
+		if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule->Get())
+		{
+			DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(FPaths::ConvertRelativePathToFull(FPaths::ProjectConfigDir()), ConfigWatcherHandle);
+		}
+	}
+
+	ConfigWatcherHandle.Reset();
+}
+
+void UTFConfigSubsystem::OnConfigDirectoryChanged(const TArray<FFileChangeData>& Changes)
+{
+	// Editors often save through several change notifications; reload each file once
+	TArray<FString, TInlineAllocator<4>> ChangedFiles;
+	for (const FFileChangeData& Change : Changes)
+	{
+		if (Change.Action != FFileChangeData::FCA_Removed)
+		{
+			ChangedFiles.AddUnique(FPaths::GetCleanFilename(Change.Filename));
+		}
+	}
+
+	for (const FString& FileName : ChangedFiles)
+	{
+		ReloadConfigFile(FileName);
+	}
+}
+
+void UTFConfigSubsystem::ReloadConfigFile(const FString& FileName)
+{
+	if (FileName == TEXT("InteractableConfig.ini"))
+	{
+		ReloadTable(FileName, InteractableConfigs, &UTFConfigSubsystem::LoadInteractableConfigs, &FTFConfigDelta::Interactable);
+	}
+	else if (FileName == TEXT("ItemConfig.ini"))
+	{
+		ReloadTable(FileName, ItemConfigs, &UTFConfigSubsystem::LoadItemConfigs, &FTFConfigDelta::Item);
+	}
+	else if (FileName == TEXT("DoorConfig.ini"))
+	{
+		ReloadTable(FileName, DoorConfigs, &UTFConfigSubsystem::LoadDoorConfigs, &FTFConfigDelta::Door);
+	}
+	else if (FileName == TEXT("ContainerConfig.ini"))
+	{
+		ReloadTable(FileName, ContainerConfigs, &UTFConfigSubsystem::LoadContainerConfigs, &FTFConfigDelta::Container);
+	}
+}
+
+template <typename ConfigType>
+void UTFConfigSubsystem::ReloadTable(const FString& FileName, TMap<FName, ConfigType>& Table, void (UTFConfigSubsystem::*LoadTable)(), const ConfigType* FTFConfigDelta::*DeltaField)
+{
+	// GConfig caches the file; drop it so the next read sees the saved contents
+	GConfig->UnloadFile(TFConfigUtils::GetConfigFilePath(FileName));
+
+	TMap<FName, ConfigType> OldTable = MoveTemp(Table);
+	Table.Reset();
+	(this->*LoadTable)();
+
+	TMap<FName, ConfigType> Deltas;
+	for (const TPair<FName, ConfigType>& Pair : Table)
+	{
+		ConfigType Delta = Pair.Value;
+		const ConfigType* OldConfig = OldTable.Find(Pair.Key);
+		if (!OldConfig || MakeDelta(Delta, *OldConfig))
+		{
+			Deltas.Add(Pair.Key, MoveTemp(Delta));
+		}
+	}
+
+	if (Deltas.IsEmpty())
+	{
+		return;
+	}
+
+	int32 NumActorsUpdated = 0;
+	if (UWorld* World = GetGameInstance()->GetWorld())
+	{
+		for (TActorIterator<ATFInteractableActor> It(World); It; ++It)
+		{
+			if (const ConfigType* Delta = Deltas.Find(It->GetInteractableID()))
+			{
+				FTFConfigDelta ConfigDelta;
+				ConfigDelta.*DeltaField = Delta;
+				It->ApplyReloadedConfig(ConfigDelta);
+				++NumActorsUpdated;
+			}
+		}
+	}
+
+	UE_LOG(LogTFConfig, Log, TEXT("UTFConfigSubsystem: Hot-reloaded %s (%d changed sections, %d actors updated)"), *FileName, Deltas.Num(), NumActorsUpdated);
+}
+
+#pragma endregion Hot Reload
+#endif
+
+void UTFConfigSubsystem::LoadInteractableConfigs()
+{
+	TArray<FString> SectionNames;
+	FString ConfigFilePath;
+
+	if (!TFConfigUtils::GetINISectionNames(TEXT("InteractableConfig.ini"), SectionNames, ConfigFilePath, LogTFInteraction, true))
+	{
+		return;
+	}
+
+	InteractableConfigs.Reserve(SectionNames.Num());
+
+	for (const FString& SectionName : SectionNames)
+	{
+		FTFInteractableConfig& Config = InteractableConfigs.Add(FName(*SectionName));
+		Config.MaxInteractionDistance = ReadFloat(SectionName, TEXT("MaxInteractionDistance"), ConfigFilePath);
+		Config.bCanInteract = ReadBool(SectionName, TEXT("bCanInteract"), ConfigFilePath);
+	}
+}
+
+void UTFConfigSubsystem::LoadItemConfigs()
+{
+	TArray<FString> SectionNames;
+	FString ConfigFilePath;
+
+	if (!TFConfigUtils::GetINISectionNames(TEXT("ItemConfig.ini"), SectionNames, ConfigFilePath, LogTFItem))
+	{
+		return;
+	}
+
+	static const TMap<FString, EItemType> ItemTypeMap = {
+		{TEXT("Food"), EItemType::Food},
+		{TEXT("Beverage"), EItemType::Beverage},
+		{TEXT("Weapon"), EItemType::Weapon},
+		{TEXT("Ammo"), EItemType::Ammo},
+		{TEXT("Document"), EItemType::Document},
+		{TEXT("Quest"), EItemType::Quest},
+		{TEXT("Backpack"), EItemType::Backpack}
+	};
+
+	ItemConfigs.Reserve(SectionNames.Num());
+
+	for (const FString& SectionName : SectionNames)
+	{
+		FTFItemConfig& Config = ItemConfigs.Add(FName(*SectionName));
+
+		if (const TOptional<FString> ItemType = ReadString(SectionName, TEXT("ItemType"), ConfigFilePath))
+		{
+			bool bMatched = false;
+			Config.ItemType = TFConfigUtils::StringToEnum(ItemType.GetValue(), ItemTypeMap, EItemType::Food, &bMatched);
+			if (!bMatched)
+			{
+				UE_LOG(LogTFItem, Warning, TEXT("UTFConfigSubsystem: Unknown ItemType '%s' in [%s], defaulting to Food"), *ItemType.GetValue(), *SectionName);
+				++NumParseErrors;
+			}
+		}
+
+		if (const TOptional<FString> ItemName = ReadString(SectionName, TEXT("ItemName"), ConfigFilePath))
+		{
+			Config.ItemName = FText::FromString(ItemName.GetValue());
+		}
+
+		if (const TOptional<FString> ItemDescription = ReadString(SectionName, TEXT("ItemDescription"), ConfigFilePath))
+		{
+			Config.ItemDescription = FText::FromString(ItemDescription.GetValue());
+		}
+
+		Config.Weight = ReadFloat(SectionName, TEXT("Weight"), ConfigFilePath);
+		Config.HungerRestore = ReadFloat(SectionName, TEXT("HungerRestore"), ConfigFilePath);
+		Config.ThirstRestore = ReadFloat(SectionName, TEXT("ThirstRestore"), ConfigFilePath);
+		Config.BackpackSlots = ReadInt(SectionName, TEXT("BackpackSlots"), ConfigFilePath);
+		Config.BackpackWeightLimit = ReadFloat(SectionName, TEXT("BackpackWeightLimit"), ConfigFilePath);
+		Config.bDestroyOnPickup = ReadBool(SectionName, TEXT("bDestroyOnPickup"), ConfigFilePath);
+		Config.DestroyDelay = ReadFloat(SectionName, TEXT("DestroyDelay"), ConfigFilePath);
+		Config.MaxInteractionDistance = ReadFloat(SectionName, TEXT("MaxInteractionDistance"), ConfigFilePath);
+		Config.ItemMesh = TFConfigUtils::GetSoftAssetFromConfig<UStaticMesh>(SectionName, TEXT("ItemMesh"), ConfigFilePath, LogTFItem, TEXT("ItemMesh"));
+		if (Config.ItemMesh.IsNull() && !ReadString(SectionName, TEXT("ItemMesh"), ConfigFilePath).Get(FString()).IsEmpty())
+		{
+			++NumParseErrors;
+		}
+	}
+}
+
+void UTFConfigSubsystem::LoadDoorConfigs()
+{
+	TArray<FString> SectionNames;
+	FString ConfigFilePath;
+
+	if (!TFConfigUtils::GetINISectionNames(TEXT("DoorConfig.ini"), SectionNames, ConfigFilePath, LogTFDoor))
+	{
+		return;
+	}
+
+	static const TMap<FString, EDoorHinge> HingeMap = {
+		{TEXT("Left"), EDoorHinge::Left},
+		{TEXT("Right"), EDoorHinge::Right}
+	};
+
+	DoorConfigs.Reserve(SectionNames.Num());
+
+	for (const FString& SectionName : SectionNames)
+	{
+		FTFDoorConfig& Config = DoorConfigs.Add(FName(*SectionName));
+
+		if (const TOptional<FString> HingeType = ReadString(SectionName, TEXT("HingeType"), ConfigFilePath))
+		{
+			bool bMatched = false;
+			Config.HingeType = TFConfigUtils::StringToEnum(HingeType.GetValue(), HingeMap, EDoorHinge::Left, &bMatched);
+			if (!bMatched)
+			{
+				UE_LOG(LogTFDoor, Warning, TEXT("UTFConfigSubsystem: Unknown HingeType '%s' in [%s], defaulting to Left"), *HingeType.GetValue(), *SectionName);
+				++NumParseErrors;
+			}
+		}
+
+		Config.MaxOpenAngle = ReadFloat(SectionName, TEXT("MaxOpenAngle"), ConfigFilePath);
+		Config.OpenDuration = ReadFloat(SectionName, TEXT("OpenDuration"), ConfigFilePath);
+		Config.CloseDuration = ReadFloat(SectionName, TEXT("CloseDuration"), ConfigFilePath);
+		Config.bAutoClose = ReadBool(SectionName, TEXT("bAutoClose"), ConfigFilePath);
+		Config.AutoCloseDelay = ReadFloat(SectionName, TEXT("AutoCloseDelay"), ConfigFilePath);
+	}
+}
+
+void UTFConfigSubsystem::LoadContainerConfigs()
+{
+	TArray<FString> SectionNames;
+	FString ConfigFilePath;
+
+	if (!TFConfigUtils::GetINISectionNames(TEXT("ContainerConfig.ini"), SectionNames, ConfigFilePath, LogTFContainer))
+	{
+		return;
+	}
+
+	ContainerConfigs.Reserve(SectionNames.Num());
+
+	for (const FString& SectionName : SectionNames)
+	{
+		FTFContainerConfig& Config = ContainerConfigs.Add(FName(*SectionName));
+		Config.MaxCapacity = ReadInt(SectionName, TEXT("MaxCapacity"), ConfigFilePath);
+
+		const TOptional<FString> ContainerName = ReadString(SectionName, TEXT("ContainerName"), ConfigFilePath);
+		if (ContainerName.IsSet() && !ContainerName->IsEmpty())
+		{
+			Config.ContainerName = FText::FromString(ContainerName.GetValue());
+		}
+	}
+}
@@ -0,0 +1,111 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFDoorAnimationSubsystem.h"
+#include "TFBaseDoorActor.h"
+#include "TFStats.h"
+
+void UTFDoorAnimationSubsystem::Deinitialize()
+{
+	Doors.Empty();
+	StartAngles.Empty();
+	EndAngles.Empty();
+	Elapsed.Empty();
+	Durations.Empty();
+	Angles.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UTFDoorAnimationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UTFDoorAnimationSubsystem, STATGROUP_Tickables);
+}
+
+void UTFDoorAnimationSubsystem::StartAnimation(ATFBaseDoorActor* Door, float StartAngle, float EndAngle, float Duration)
+{
+	if (!Door)
+	{
+		return;
+	}
+
+	int32 Index = Doors.Find(Door);
+	if (Index == INDEX_NONE)
+	{
+		Index = Doors.Add(Door);
+		StartAngles.AddUninitialized();
+		EndAngles.AddUninitialized();
+		Elapsed.AddUninitialized();
+		Durations.AddUninitialized();
+		Angles.AddUninitialized();
+	}
+
+	StartAngles[Index] = StartAngle;
+	EndAngles[Index] = EndAngle;
+	Elapsed[Index] = 0.0f;
+	Durations[Index] = FMath::Max(Duration, KINDA_SMALL_NUMBER);
+	Angles[Index] = StartAngle;
+}
+
+void UTFDoorAnimationSubsystem::StopAnimation(ATFBaseDoorActor* Door)
+{
+	const int32 Index = Doors.Find(Door);
+	if (Index != INDEX_NONE)
+	{
+		RemoveAt(Index);
+	}
+}
+
+void UTFDoorAnimationSubsystem::RemoveAt(int32 Index)
+{
+	Doors.RemoveAtSwap(Index);
+	StartAngles.RemoveAtSwap(Index);
+	EndAngles.RemoveAtSwap(Index);
+	Elapsed.RemoveAtSwap(Index);
+	Durations.RemoveAtSwap(Index);
+	Angles.RemoveAtSwap(Index);
+}
+
+void UTFDoorAnimationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TF_SCOPE_CYCLE_COUNTER(DoorAnimation);
+
+	const int32 NumDoors = Doors.Num();
+	INC_DWORD_STAT_BY(STAT_TFDoorsAnimated, NumDoors);
+
+	// Evaluate smoothstep easing for every moving door
+	for (int32 Index = 0; Index < NumDoors; ++Index)
+	{
+		Elapsed[Index] += DeltaTime;
+		const float Alpha = FMath::Clamp(Elapsed[Index] / Durations[Index], 0.0f, 1.0f);
+		const float EasedAlpha = Alpha * Alpha * (3.0f - 2.0f * Alpha);
+		Angles[Index] = FMath::Lerp(StartAngles[Index], EndAngles[Index], EasedAlpha);
+	}
+
+	// Push rotations and collect finished doors
+	TArray<ATFBaseDoorActor*, TInlineAllocator<8>> FinishedDoors;
+	for (int32 Index = NumDoors - 1; Index >= 0; --Index)
+	{
+		ATFBaseDoorActor* Door = Doors[Index];
+		if (!IsValid(Door))
+		{
+			RemoveAt(Index);
+			continue;
+		}
+
+		Door->SetAnimatedAngle(Angles[Index]);
+
+		if (Elapsed[Index] >= Durations[Index])
+		{
+			FinishedDoors.Add(Door);
+			RemoveAt(Index);
+		}
+	}
+
+	// Completion may start a new animation (e.g. zero-delay auto close)
+	for (ATFBaseDoorActor* Door : FinishedDoors)
+	{
+		Door->FinishDoorAnimation();
+	}
+}
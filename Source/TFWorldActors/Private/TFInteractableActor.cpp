@@ -2,8 +2,9 @@
 
 #include "TFInteractableActor.h"
 #include "TFTypes.h"
+#include "TFConfigSubsystem.h"
+#include "TFInteractableGridSubsystem.h"
 #include "Components/StaticMeshComponent.h"
-#include "Misc/ConfigCacheIni.h"
 
 ATFInteractableActor::ATFInteractableActor()
 {
@@ -28,26 +29,98 @@ void ATFInteractableActor::BeginPlay()
 	{
 		LoadConfigFromINI();
 	}
+
+	UpdateGridEntry();
+
+	// Physics-driven pickups move the mesh away from the root
+	if (MeshComponent)
+	{
+		MeshTransformUpdatedHandle = MeshComponent->TransformUpdated.AddUObject(this, &ATFInteractableActor::OnMeshTransformUpdated);
+	}
+}
+
+void ATFInteractableActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (MeshComponent)
+	{
+		MeshComponent->TransformUpdated.Remove(MeshTransformUpdatedHandle);
+	}
+
+	if (UTFInteractableGridSubsystem* Grid = UTFInteractableGridSubsystem::Get(this))
+	{
+		Grid->UnregisterInteractable(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ATFInteractableActor::UpdateGridEntry()
+{
+	UTFInteractableGridSubsystem* Grid = UTFInteractableGridSubsystem::Get(this);
+	if (!Grid)
+	{
+		return;
+	}
+
+	FVector Origin, Extent;
+	GetActorBounds(false, Origin, Extent);
+	Grid->UpdateInteractable(this, Origin, Extent.Size() + GridMoveSlack);
+
+	GridMeshOrigin = MeshComponent ? MeshComponent->Bounds.Origin : Origin;
+}
+
+void ATFInteractableActor::OnMeshTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	// Fires on every physics step; the padded radius still covers small moves
+	if (FVector::DistSquared(MeshComponent->Bounds.Origin, GridMeshOrigin) > FMath::Square(GridMoveSlack))
+	{
+		UpdateGridEntry();
+	}
 }
 
 void ATFInteractableActor::LoadConfigFromINI()
 {
-	const FString SectionName = InteractableID.ToString();
-	FString ConfigFilePath;
+	const UTFConfigSubsystem* ConfigSubsystem = UTFConfigSubsystem::Get(this);
+	const FTFInteractableConfig* Config = ConfigSubsystem ? ConfigSubsystem->FindInteractableConfig(InteractableID) : nullptr;
 
-	if (!TFConfigUtils::LoadINISection(TEXT("InteractableConfig.ini"), SectionName, ConfigFilePath, LogTFInteraction, true))
+	if (!Config)
 	{
 		return;
 	}
 
-	UE_LOG(LogTFInteraction, Log, TEXT("ATFInteractableActor: Loading config for InteractableID '%s'"), *SectionName);
+	UE_LOG(LogTFInteraction, Log, TEXT("ATFInteractableActor: Loading config for InteractableID '%s'"), *InteractableID.ToString());
 
-	GConfig->GetFloat(*SectionName, TEXT("MaxInteractionDistance"), MaxInteractionDistance, ConfigFilePath);
-	GConfig->GetBool(*SectionName, TEXT("bCanInteract"), bCanInteract, ConfigFilePath);
+	ApplyInteractableConfig(*Config);
+
+	UE_LOG(LogTFInteraction, Log, TEXT("ATFInteractableActor: Config loaded successfully for InteractableID '%s'"), *InteractableID.ToString());
+}
+
+void ATFInteractableActor::ApplyInteractableConfig(const FTFInteractableConfig& Config)
+{
+	MaxInteractionDistance = Config.MaxInteractionDistance.Get(MaxInteractionDistance);
+	bCanInteract = Config.bCanInteract.Get(bCanInteract);
 
 	MaxInteractionDistance = FMath::Clamp(MaxInteractionDistance, 50.0f, 1000.0f);
+}
 
-	UE_LOG(LogTFInteraction, Log, TEXT("ATFInteractableActor: Config loaded successfully for InteractableID '%s'"), *SectionName);
+void ATFInteractableActor::ApplyReloadedConfig(const FTFConfigDelta& Delta)
+{
+	if (!bUseDataDrivenConfig || InteractableID.IsNone())
+	{
+		return;
+	}
+
+	OnConfigReloaded(Delta);
+
+	UE_LOG(LogTFInteraction, Log, TEXT("ATFInteractableActor: Reapplied reloaded config for '%s' on %s"), *InteractableID.ToString(), *GetName());
+}
+
+void ATFInteractableActor::OnConfigReloaded(const FTFConfigDelta& Delta)
+{
+	if (Delta.Interactable)
+	{
+		ApplyInteractableConfig(*Delta.Interactable);
+	}
 }
 
 
@@ -0,0 +1,78 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFItemAssetSubsystem.h"
+#include "TFPickupableInterface.h"
+#include "TFTypes.h"
+#include "Engine/GameInstance.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+
+void UTFItemAssetSubsystem::Deinitialize()
+{
+	for (TPair<FSoftObjectPath, FPreloadedMesh>& Pair : PreloadedMeshes)
+	{
+		if (Pair.Value.Handle.IsValid())
+		{
+			Pair.Value.Handle->ReleaseHandle();
+		}
+	}
+	PreloadedMeshes.Empty();
+
+	Super::Deinitialize();
+}
+
+UTFItemAssetSubsystem* UTFItemAssetSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UTFItemAssetSubsystem>() : nullptr;
+}
+
+TSharedPtr<FStreamableHandle> UTFItemAssetSubsystem::RequestItemMesh(const TSoftObjectPtr<UStaticMesh>& Mesh, FStreamableDelegate OnLoaded)
+{
+	if (Mesh.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (Mesh.Get())
+	{
+		OnLoaded.ExecuteIfBound();
+		return nullptr;
+	}
+
+	return StreamableManager.RequestAsyncLoad(Mesh.ToSoftObjectPath(), MoveTemp(OnLoaded));
+}
+
+void UTFItemAssetSubsystem::AddPreloadedMesh(const FSoftObjectPath& Mesh)
+{
+	if (Mesh.IsNull())
+	{
+		return;
+	}
+
+	FPreloadedMesh& Preloaded = PreloadedMeshes.FindOrAdd(Mesh);
+	if (Preloaded.RefCount++ == 0)
+	{
+		Preloaded.Handle = StreamableManager.RequestAsyncLoad(Mesh);
+
+		UE_LOG(LogTFItem, Verbose, TEXT("UTFItemAssetSubsystem: %d item meshes preloaded"), PreloadedMeshes.Num());
+	}
+}
+
+void UTFItemAssetSubsystem::RemovePreloadedMesh(const FSoftObjectPath& Mesh)
+{
+	FPreloadedMesh* Preloaded = PreloadedMeshes.Find(Mesh);
+	if (!Preloaded || --Preloaded->RefCount > 0)
+	{
+		return;
+	}
+
+	if (Preloaded->Handle.IsValid())
+	{
+		Preloaded->Handle->ReleaseHandle();
+	}
+	PreloadedMeshes.Remove(Mesh);
+
+	UE_LOG(LogTFItem, Verbose, TEXT("UTFItemAssetSubsystem: %d item meshes preloaded"), PreloadedMeshes.Num());
+}
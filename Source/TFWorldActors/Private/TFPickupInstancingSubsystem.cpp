@@ -0,0 +1,158 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFPickupInstancingSubsystem.h"
+#include "TFPickupableActor.h"
+#include "TFStats.h"
+#include "TFTypes.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+
+bool UTFPickupInstancingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTFPickupInstancingSubsystem::Deinitialize()
+{
+	Clusters.Empty();
+	InstancedPickups.Empty();
+	ClusterComponents.Empty();
+	InstanceHost = nullptr;
+
+	SET_DWORD_STAT(STAT_TFPickupsInstanced, 0);
+	SET_DWORD_STAT(STAT_TFPickupClusters, 0);
+
+	Super::Deinitialize();
+}
+
+UTFPickupInstancingSubsystem* UTFPickupInstancingSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTFPickupInstancingSubsystem>() : nullptr;
+}
+
+FIntVector UTFPickupInstancingSubsystem::GetCell(const FVector& Location) const
+{
+	const double Size = FMath::Max(1.0f, CellSize);
+	return FIntVector(
+		FMath::FloorToInt32(Location.X / Size),
+		FMath::FloorToInt32(Location.Y / Size),
+		FMath::FloorToInt32(Location.Z / Size)
+	);
+}
+
+UTFPickupInstancingSubsystem::FCluster* UTFPickupInstancingSubsystem::FindOrAddCluster(const FClusterKey& Key, UStaticMesh* Mesh)
+{
+	if (FCluster* Cluster = Clusters.Find(Key))
+	{
+		return Cluster;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	if (!InstanceHost)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		InstanceHost = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!InstanceHost)
+		{
+			return nullptr;
+		}
+
+		USceneComponent* HostRoot = NewObject<USceneComponent>(InstanceHost, TEXT("Root"));
+		InstanceHost->SetRootComponent(HostRoot);
+		HostRoot->RegisterComponent();
+	}
+
+	// Collision stays on the pickup actors; the cluster only draws
+	UInstancedStaticMeshComponent* Component = NewObject<UInstancedStaticMeshComponent>(InstanceHost);
+	Component->SetStaticMesh(Mesh);
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->SetupAttachment(InstanceHost->GetRootComponent());
+	Component->RegisterComponent();
+
+	ClusterComponents.Add(Component);
+
+	FCluster& Cluster = Clusters.Add(Key);
+	Cluster.Component = Component;
+
+	SET_DWORD_STAT(STAT_TFPickupClusters, Clusters.Num());
+
+	return &Cluster;
+}
+
+bool UTFPickupInstancingSubsystem::InstancePickup(ATFPickupableActor* Pickup)
+{
+	UStaticMeshComponent* MeshComponent = Pickup ? Pickup->GetMeshComponent() : nullptr;
+	UStaticMesh* Mesh = MeshComponent ? MeshComponent->GetStaticMesh() : nullptr;
+
+	// Material overrides would be lost on the shared component
+	if (!bEnableInstancing || !Mesh || MeshComponent->GetNumOverrideMaterials() > 0 || InstancedPickups.Contains(Pickup))
+	{
+		return false;
+	}
+
+	const FTransform InstanceTransform = MeshComponent->GetComponentTransform();
+	const FClusterKey Key{GetCell(InstanceTransform.GetLocation()), Mesh};
+
+	FCluster* Cluster = FindOrAddCluster(Key, Mesh);
+	if (!Cluster)
+	{
+		return false;
+	}
+
+	Cluster->Component->AddInstance(InstanceTransform, true);
+	Cluster->InstanceOwners.Add(Pickup);
+	InstancedPickups.Add(Pickup, Key);
+
+	MeshComponent->SetHiddenInGame(true);
+
+	SET_DWORD_STAT(STAT_TFPickupsInstanced, InstancedPickups.Num());
+
+	return true;
+}
+
+void UTFPickupInstancingSubsystem::PromotePickup(ATFPickupableActor* Pickup)
+{
+	FClusterKey Key;
+	if (!Pickup || !InstancedPickups.RemoveAndCopyValue(Pickup, Key))
+	{
+		return;
+	}
+
+	if (FCluster* Cluster = Clusters.Find(Key))
+	{
+		const int32 InstanceIndex = Cluster->InstanceOwners.IndexOfByKey(Pickup);
+		if (InstanceIndex != INDEX_NONE)
+		{
+			// RemoveInstance keeps the order of the remaining instances, matching InstanceOwners
+			Cluster->Component->RemoveInstance(InstanceIndex);
+			Cluster->InstanceOwners.RemoveAt(InstanceIndex);
+		}
+
+		if (Cluster->InstanceOwners.IsEmpty())
+		{
+			ClusterComponents.RemoveSwap(Cluster->Component);
+			Cluster->Component->DestroyComponent();
+			Clusters.Remove(Key);
+		}
+	}
+
+	if (UStaticMeshComponent* MeshComponent = Pickup->GetMeshComponent())
+	{
+		MeshComponent->SetHiddenInGame(false);
+	}
+
+	SET_DWORD_STAT(STAT_TFPickupsInstanced, InstancedPickups.Num());
+	SET_DWORD_STAT(STAT_TFPickupClusters, Clusters.Num());
+}
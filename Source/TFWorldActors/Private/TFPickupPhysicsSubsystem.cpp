@@ -0,0 +1,225 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFPickupPhysicsSubsystem.h"
+#include "TFPickupableActor.h"
+#include "TFStats.h"
+#include "TFTypes.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+
+bool UTFPickupPhysicsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTFPickupPhysicsSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(CheckTimerHandle);
+	}
+
+	TrackedPickups.Empty();
+	NumFrozen = 0;
+	UpdateBodyStats();
+
+	Super::Deinitialize();
+}
+
+UTFPickupPhysicsSubsystem* UTFPickupPhysicsSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTFPickupPhysicsSubsystem>() : nullptr;
+}
+
+#pragma region Registration
+
+void UTFPickupPhysicsSubsystem::RegisterPickup(ATFPickupableActor* Pickup)
+{
+	if (!Pickup)
+	{
+		return;
+	}
+
+	TrackedPickups.FindOrAdd(Pickup).Pickup = Pickup;
+
+	UWorld* World = GetWorld();
+	if (World && !World->GetTimerManager().IsTimerActive(CheckTimerHandle))
+	{
+		World->GetTimerManager().SetTimer(CheckTimerHandle, this, &UTFPickupPhysicsSubsystem::RunFreezePass, CheckInterval, true);
+	}
+
+	UpdateBodyStats();
+}
+
+void UTFPickupPhysicsSubsystem::UnregisterPickup(ATFPickupableActor* Pickup)
+{
+	FTrackedPickup Entry;
+	if (!Pickup || !TrackedPickups.RemoveAndCopyValue(Pickup, Entry))
+	{
+		return;
+	}
+
+	if (Entry.bFrozen)
+	{
+		SetFrozen(Entry, *Pickup, false);
+	}
+
+	if (TrackedPickups.IsEmpty())
+	{
+		if (UWorld* World = GetWorld())
+		{
+			World->GetTimerManager().ClearTimer(CheckTimerHandle);
+		}
+	}
+
+	UpdateBodyStats();
+}
+
+#pragma endregion Registration
+
+#pragma region Freeze Policy
+
+void UTFPickupPhysicsSubsystem::RunFreezePass()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	TArray<FVector, TInlineAllocator<4>> PlayerLocations;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (const APawn* Pawn = PC ? PC->GetPawn() : nullptr)
+		{
+			PlayerLocations.Add(Pawn->GetActorLocation());
+		}
+	}
+
+	auto IsPlayerWithin = [&PlayerLocations](const FVector& Location, float Radius)
+	{
+		const float RadiusSq = FMath::Square(Radius);
+		for (const FVector& PlayerLocation : PlayerLocations)
+		{
+			if (FVector::DistSquared(PlayerLocation, Location) < RadiusSq)
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	for (auto It = TrackedPickups.CreateIterator(); It; ++It)
+	{
+		ATFPickupableActor* Pickup = It.Value().Pickup.Get();
+		UStaticMeshComponent* Mesh = Pickup ? Pickup->GetMeshComponent() : nullptr;
+		if (!Mesh)
+		{
+			NumFrozen -= It.Value().bFrozen ? 1 : 0;
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// Pending backpack equips and pooled actors have collision off; leave them alone
+		if (!Pickup->GetActorEnableCollision())
+		{
+			continue;
+		}
+
+		const FVector Location = Mesh->GetComponentLocation();
+
+		if (It.Value().bFrozen)
+		{
+			if (IsPlayerWithin(Location, ThawRadius))
+			{
+				SetFrozen(It.Value(), *Pickup, false);
+			}
+			continue;
+		}
+
+		if (!Mesh->IsSimulatingPhysics() || Mesh->RigidBodyIsAwake())
+		{
+			It.Value().SleepTime = 0.0f;
+			continue;
+		}
+
+		It.Value().SleepTime += CheckInterval;
+
+		if (It.Value().SleepTime >= FreezeSleepTime && !IsPlayerWithin(Location, FreezeRadius))
+		{
+			SetFrozen(It.Value(), *Pickup, true);
+		}
+	}
+
+	if (TrackedPickups.IsEmpty())
+	{
+		World->GetTimerManager().ClearTimer(CheckTimerHandle);
+	}
+
+	UpdateBodyStats();
+}
+
+void UTFPickupPhysicsSubsystem::WakePickup(ATFPickupableActor* Pickup)
+{
+	FTrackedPickup* Entry = Pickup ? TrackedPickups.Find(Pickup) : nullptr;
+	if (Entry && Entry->bFrozen)
+	{
+		SetFrozen(*Entry, *Pickup, false);
+		UpdateBodyStats();
+	}
+}
+
+void UTFPickupPhysicsSubsystem::WakePickupsNear(const FVector& Location, float Radius)
+{
+	if (NumFrozen == 0)
+	{
+		return;
+	}
+
+	const float RadiusSq = FMath::Square(Radius);
+	for (TPair<TObjectKey<ATFPickupableActor>, FTrackedPickup>& Pair : TrackedPickups)
+	{
+		ATFPickupableActor* Pickup = Pair.Value.Pickup.Get();
+		const UStaticMeshComponent* Mesh = Pickup ? Pickup->GetMeshComponent() : nullptr;
+
+		// Simulation detaches the mesh from the root, so the actor location can be far behind it
+		if (Pair.Value.bFrozen && Mesh && FVector::DistSquared(Mesh->GetComponentLocation(), Location) <= RadiusSq)
+		{
+			SetFrozen(Pair.Value, *Pickup, false);
+		}
+	}
+
+	UpdateBodyStats();
+}
+
+void UTFPickupPhysicsSubsystem::SetFrozen(FTrackedPickup& Entry, ATFPickupableActor& Pickup, bool bFrozen)
+{
+	Pickup.SetPhysicsFrozen(bFrozen);
+	Entry.bFrozen = bFrozen;
+	Entry.SleepTime = 0.0f;
+
+	if (bFrozen)
+	{
+		++NumFrozen;
+		INC_DWORD_STAT(STAT_TFPickupFreezes);
+	}
+	else
+	{
+		--NumFrozen;
+		INC_DWORD_STAT(STAT_TFPickupThaws);
+	}
+}
+
+void UTFPickupPhysicsSubsystem::UpdateBodyStats() const
+{
+	SET_DWORD_STAT(STAT_TFPickupsTracked, TrackedPickups.Num());
+	SET_DWORD_STAT(STAT_TFPickupsSimulating, TrackedPickups.Num() - NumFrozen);
+	SET_DWORD_STAT(STAT_TFPickupsFrozen, NumFrozen);
+}
+
+#pragma endregion Freeze Policy
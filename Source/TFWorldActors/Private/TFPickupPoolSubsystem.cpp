@@ -0,0 +1,104 @@
+// Copyright TF Project. All Rights Reserved.
+
+#include "TFPickupPoolSubsystem.h"
+#include "TFPickupableActor.h"
+#include "TFTypes.h"
+#include "Engine/World.h"
+
+bool UTFPickupPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTFPickupPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	const int32 NumToSpawn = FMath::Clamp(PrewarmCount, 0, MaxPoolSize);
+	FreePickups.Reserve(NumToSpawn);
+
+	for (int32 i = 0; i < NumToSpawn; ++i)
+	{
+		if (ATFPickupableActor* Pickup = SpawnPooledActor(InWorld))
+		{
+			Pickup->DeactivateToPool();
+			FreePickups.Add(Pickup);
+		}
+	}
+
+	UE_LOG(LogTFItem, Log, TEXT("UTFPickupPoolSubsystem: Pre-warmed %d pickup actors"), FreePickups.Num());
+}
+
+void UTFPickupPoolSubsystem::Deinitialize()
+{
+	FreePickups.Empty();
+
+	Super::Deinitialize();
+}
+
+UTFPickupPoolSubsystem* UTFPickupPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTFPickupPoolSubsystem>() : nullptr;
+}
+
+ATFPickupableActor* UTFPickupPoolSubsystem::SpawnPooledActor(UWorld& World)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	return World.SpawnActor<ATFPickupableActor>(ATFPickupableActor::StaticClass(), FTransform::Identity, SpawnParams);
+}
+
+ATFPickupableActor* UTFPickupPoolSubsystem::AcquirePickup(const FVector& Location, AActor* Owner)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	ATFPickupableActor* Pickup = nullptr;
+	while (!Pickup && FreePickups.Num() > 0)
+	{
+		Pickup = FreePickups.Pop(EAllowShrinking::No);
+		if (!IsValid(Pickup))
+		{
+			Pickup = nullptr;
+		}
+	}
+
+	if (!Pickup)
+	{
+		Pickup = SpawnPooledActor(*World);
+		if (!Pickup)
+		{
+			return nullptr;
+		}
+	}
+
+	Pickup->SetOwner(Owner);
+	Pickup->ActivateFromPool(Location);
+
+	return Pickup;
+}
+
+bool UTFPickupPoolSubsystem::ReleasePickup(ATFPickupableActor* Pickup)
+{
+	if (!IsValid(Pickup))
+	{
+		return false;
+	}
+
+	// Blueprint subclasses carry their own components and defaults; only recycle the native class
+	if (Pickup->GetClass() != ATFPickupableActor::StaticClass() || FreePickups.Num() >= MaxPoolSize)
+	{
+		Pickup->Destroy();
+		return false;
+	}
+
+	Pickup->DeactivateToPool();
+	FreePickups.AddUnique(Pickup);
+
+	return true;
+}
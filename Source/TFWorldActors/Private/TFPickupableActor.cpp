@@ -2,39 +2,97 @@
 
 #include "TFPickupableActor.h"
 #include "TFTypes.h"
+#include "TFConfigSubsystem.h"
+#include "TFPickupPoolSubsystem.h"
+#include "TFInteractableGridSubsystem.h"
+#include "TFItemAssetSubsystem.h"
+#include "TFPickupPhysicsSubsystem.h"
+#include "TFPickupInstancingSubsystem.h"
 #include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "UObject/ConstructorHelpers.h"
 #include "Kismet/GameplayStatics.h"
 #include "TFInventoryHolderInterface.h"
-#include "Misc/ConfigCacheIni.h"
 
 
 ATFPickupableActor::ATFPickupableActor()
 {
 	PrimaryActorTick.bCanEverTick = false;
 
+	static ConstructorHelpers::FObjectFinder<UStaticMesh> SphereMesh(TEXT("/Engine/BasicShapes/Sphere.Sphere"));
+	static ConstructorHelpers::FObjectFinder<UStaticMesh> CubeMesh(TEXT("/Engine/BasicShapes/Cube.Cube"));
+	ItemPlaceholderMesh = SphereMesh.Object;
+	BackpackPlaceholderMesh = CubeMesh.Object;
+
 	// Enable physics for pickable actors
 	if (MeshComponent)
 	{
-		MeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-		MeshComponent->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Block);
-		MeshComponent->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Block);
+		ApplyPickupCollision();
 		MeshComponent->SetSimulatePhysics(true);
 	}
 }
 
+void ATFPickupableActor::ApplyPickupCollision()
+{
+	MeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	MeshComponent->SetCollisionResponseToAllChannels(ECR_Ignore);
+	MeshComponent->SetCollisionResponseToChannel(ECC_Visibility, ECR_Block);
+	MeshComponent->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Block);
+	MeshComponent->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Block);
+}
+
+void ATFPickupableActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	GetWorldTimerManager().ClearTimer(ReleaseTimerHandle);
+	CancelItemMeshLoad();
+
+	if (UTFPickupPhysicsSubsystem* PickupPhysics = UTFPickupPhysicsSubsystem::Get(this))
+	{
+		PickupPhysics->UnregisterPickup(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ATFPickupableActor::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Capture editor-assigned mesh and scale into ItemData for persistence through pickup/drop cycles
-	if (MeshComponent && MeshComponent->GetStaticMesh() && !ItemData.ItemMesh)
+	// Spawned without data (e.g. dropped items); SetItemData provides the instance
+	if (ItemDefinition.ItemID.IsNone())
+	{
+		// Placed in the level, so nothing will call SetItemData; it cannot be picked up
+		if (IsNetStartupActor())
+		{
+			UE_LOG(LogTFItem, Warning, TEXT("ATFPickupableActor: %s has no ItemID (InteractableID '%s') and cannot be picked up"),
+				*GetName(), *InteractableID.ToString());
+		}
+		return;
+	}
+
+	// Capture editor-assigned mesh and scale for persistence through pickup/drop cycles
+	if (MeshComponent && MeshComponent->GetStaticMesh() && ItemDefinition.ItemMesh.IsNull())
+	{
+		ItemDefinition.ItemMesh = MeshComponent->GetStaticMesh();
+		ItemDefinition.ItemMeshScale = MeshComponent->GetRelativeScale3D();
+	}
+
+	// Capture MaxInteractionDistance for persistence through pickup/drop cycles
+	ItemDefinition.MaxInteractionDistance = MaxInteractionDistance;
+
+	UTFConfigSubsystem* ConfigSubsystem = UTFConfigSubsystem::Get(this);
+	ItemData = FItemData(ConfigSubsystem ? ConfigSubsystem->InternItemDefinition(ItemDefinition) : UTFItemDefinition::Create(ItemDefinition));
+
+	// ItemConfig.ini may point at a different mesh than the one placed in the editor
+	if (MeshComponent && ItemDefinition.ItemMesh.ToSoftObjectPath() != FSoftObjectPath(MeshComponent->GetStaticMesh()))
 	{
-		ItemData.ItemMesh = MeshComponent->GetStaticMesh();
-		ItemData.ItemMeshScale = MeshComponent->GetRelativeScale3D();
+		ApplyItemMesh();
 	}
 
-	// Capture MaxInteractionDistance into ItemData for persistence through pickup/drop cycles
-	ItemData.MaxInteractionDistance = MaxInteractionDistance;
+	if (UTFPickupPhysicsSubsystem* PickupPhysics = UTFPickupPhysicsSubsystem::Get(this))
+	{
+		PickupPhysics->RegisterPickup(this);
+	}
 }
 
 void ATFPickupableActor::LoadConfigFromINI()
@@ -48,111 +106,104 @@ void ATFPickupableActor::LoadConfigFromINI()
 		return;
 	}
 
-	const FString SectionName = InteractableID.ToString();
-	FString ConfigFilePath;
+	const UTFConfigSubsystem* ConfigSubsystem = UTFConfigSubsystem::Get(this);
+	const FTFItemConfig* Config = ConfigSubsystem ? ConfigSubsystem->FindItemConfig(InteractableID) : nullptr;
 
-	if (!TFConfigUtils::LoadINISection(TEXT("ItemConfig.ini"), SectionName, ConfigFilePath, LogTFItem))
+	if (!Config)
 	{
+		UE_LOG(LogTFItem, Warning, TEXT("ATFPickupableActor: Section [%s] not found in ItemConfig.ini"), *InteractableID.ToString());
 		return;
 	}
 
-	ItemData.ItemID = InteractableID;
-
-	UE_LOG(LogTFItem, Log, TEXT("ATFPickupableActor: Loading config for InteractableID '%s'"), *SectionName);
+	ItemDefinition.ItemID = InteractableID;
 
-	FString StringValue;
-
-#pragma region Item Type
-
-	if (GConfig->GetString(*SectionName, TEXT("ItemType"), StringValue, ConfigFilePath))
-	{
-		static const TMap<FString, EItemType> ItemTypeMap = {
-			{TEXT("Food"), EItemType::Food},
-			{TEXT("Beverage"), EItemType::Beverage},
-			{TEXT("Weapon"), EItemType::Weapon},
-			{TEXT("Ammo"), EItemType::Ammo},
-			{TEXT("Document"), EItemType::Document},
-			{TEXT("Quest"), EItemType::Quest},
-			{TEXT("Backpack"), EItemType::Backpack}
-		};
+	UE_LOG(LogTFItem, Log, TEXT("ATFPickupableActor: Loading config for InteractableID '%s'"), *InteractableID.ToString());
 
-		bool bMatched = false;
-		ItemData.ItemType = TFConfigUtils::StringToEnum(StringValue, ItemTypeMap, EItemType::Food, &bMatched);
-		if (!bMatched)
-		{
-			UE_LOG(LogTFItem, Warning, TEXT("ATFPickupableActor: Unknown ItemType '%s', defaulting to Food"), *StringValue);
-		}
-	}
+	ApplyItemConfig(*Config);
 
-#pragma endregion Item Type
+	UE_LOG(LogTFItem, Log, TEXT("ATFPickupableActor: Config loaded successfully for InteractableID '%s' (Type: %d)"),
+		*InteractableID.ToString(), static_cast<int32>(ItemDefinition.ItemType));
+}
 
+void ATFPickupableActor::ApplyItemConfig(const FTFItemConfig& Config)
+{
 #pragma region Basic Item Data
 
-	if (GConfig->GetString(*SectionName, TEXT("ItemName"), StringValue, ConfigFilePath))
-	{
-		ItemData.ItemName = FText::FromString(StringValue);
-	}
-
-	if (GConfig->GetString(*SectionName, TEXT("ItemDescription"), StringValue, ConfigFilePath))
-	{
-		ItemData.ItemDescription = FText::FromString(StringValue);
-	}
-
-	GConfig->GetFloat(*SectionName, TEXT("Weight"), ItemData.Weight, ConfigFilePath);
-
-	ItemData.Weight = FMath::Max(0.0f, ItemData.Weight);
+	ItemDefinition.ItemType = Config.ItemType.Get(ItemDefinition.ItemType);
+	ItemDefinition.ItemName = Config.ItemName.Get(ItemDefinition.ItemName);
+	ItemDefinition.ItemDescription = Config.ItemDescription.Get(ItemDefinition.ItemDescription);
+	ItemDefinition.Weight = FMath::Max(0.0f, Config.Weight.Get(ItemDefinition.Weight));
 
 #pragma endregion Basic Item Data
 
 #pragma region Food/Beverage Data
 
-	if (ItemData.ItemType == EItemType::Food || ItemData.ItemType == EItemType::Beverage)
+	if (ItemDefinition.ItemType == EItemType::Food || ItemDefinition.ItemType == EItemType::Beverage)
 	{
-		GConfig->GetFloat(*SectionName, TEXT("HungerRestore"), ItemData.HungerRestore, ConfigFilePath);
-		GConfig->GetFloat(*SectionName, TEXT("ThirstRestore"), ItemData.ThirstRestore, ConfigFilePath);
-
-		ItemData.HungerRestore = FMath::Max(0.0f, ItemData.HungerRestore);
-		ItemData.ThirstRestore = FMath::Max(0.0f, ItemData.ThirstRestore);
+		ItemDefinition.HungerRestore = FMath::Max(0.0f, Config.HungerRestore.Get(ItemDefinition.HungerRestore));
+		ItemDefinition.ThirstRestore = FMath::Max(0.0f, Config.ThirstRestore.Get(ItemDefinition.ThirstRestore));
 	}
 
 #pragma endregion Food/Beverage Data
 
 #pragma region Backpack-Specific Data
 
-	if (ItemData.ItemType == EItemType::Backpack)
+	if (ItemDefinition.ItemType == EItemType::Backpack)
 	{
-		GConfig->GetInt(*SectionName, TEXT("BackpackSlots"), ItemData.BackpackSlots, ConfigFilePath);
-		GConfig->GetFloat(*SectionName, TEXT("BackpackWeightLimit"), ItemData.BackpackWeightLimit, ConfigFilePath);
-
-		ItemData.BackpackSlots = FMath::Max(1, ItemData.BackpackSlots);
-		ItemData.BackpackWeightLimit = FMath::Max(1.0f, ItemData.BackpackWeightLimit);
+		ItemDefinition.BackpackSlots = FMath::Max(1, Config.BackpackSlots.Get(ItemDefinition.BackpackSlots));
+		ItemDefinition.BackpackWeightLimit = FMath::Max(1.0f, Config.BackpackWeightLimit.Get(ItemDefinition.BackpackWeightLimit));
 	}
 
 #pragma endregion Backpack-Specific Data
 
 #pragma region Pickup Settings
 
-	GConfig->GetBool(*SectionName, TEXT("bDestroyOnPickup"), bDestroyOnPickup, ConfigFilePath);
-	GConfig->GetFloat(*SectionName, TEXT("DestroyDelay"), DestroyDelay, ConfigFilePath);
-
-	// Validate pickup settings
-	DestroyDelay = FMath::Max(0.0f, DestroyDelay);
+	bDestroyOnPickup = Config.bDestroyOnPickup.Get(bDestroyOnPickup);
+	DestroyDelay = FMath::Max(0.0f, Config.DestroyDelay.Get(DestroyDelay));
 
 #pragma endregion Pickup Settings
 
 #pragma region Interaction Distance Override
 
 	// Allow ItemConfig.ini to override MaxInteractionDistance (inherited from InteractableConfig.ini)
-	GConfig->GetFloat(*SectionName, TEXT("MaxInteractionDistance"), MaxInteractionDistance, ConfigFilePath);
-	MaxInteractionDistance = FMath::Clamp(MaxInteractionDistance, 50.0f, 1000.0f);
-
-	// Store in ItemData for persistence through pickup/drop cycles
-	ItemData.MaxInteractionDistance = MaxInteractionDistance;
+	MaxInteractionDistance = FMath::Clamp(Config.MaxInteractionDistance.Get(MaxInteractionDistance), 50.0f, 1000.0f);
 
 #pragma endregion Interaction Distance Override
 
-	UE_LOG(LogTFItem, Log, TEXT("ATFPickupableActor: Config loaded successfully for InteractableID '%s' (Type: %d)"),
-		*SectionName, static_cast<int32>(ItemData.ItemType));
+	if (!Config.ItemMesh.IsNull())
+	{
+		ItemDefinition.ItemMesh = Config.ItemMesh;
+	}
+}
+
+void ATFPickupableActor::OnConfigReloaded(const FTFConfigDelta& Delta)
+{
+	Super::OnConfigReloaded(Delta);
+
+	// Only level-placed pickups that have resolved their item are affected
+	if (!Delta.Item || !ItemData.IsValid())
+	{
+		return;
+	}
+
+	const TSoftObjectPtr<UStaticMesh> PreviousMesh = ItemDefinition.ItemMesh;
+
+	ApplyItemConfig(*Delta.Item);
+	ItemDefinition.MaxInteractionDistance = MaxInteractionDistance;
+
+	UTFConfigSubsystem* ConfigSubsystem = UTFConfigSubsystem::Get(this);
+	ItemData = FItemData(ConfigSubsystem ? ConfigSubsystem->InternItemDefinition(ItemDefinition) : UTFItemDefinition::Create(ItemDefinition));
+
+	if (ItemDefinition.ItemMesh != PreviousMesh)
+	{
+		// Instanced clusters are keyed by mesh; thaw so this actor draws the new one
+		if (UTFPickupPhysicsSubsystem* PickupPhysics = UTFPickupPhysicsSubsystem::Get(this))
+		{
+			PickupPhysics->WakePickup(this);
+		}
+
+		ApplyItemMesh();
+	}
 }
 
 bool ATFPickupableActor::HandleBackpackPickup(APawn* Picker)
@@ -176,7 +227,9 @@ bool ATFPickupableActor::HandleBackpackPickup(APawn* Picker)
 		return false;
 	}
 
-	if (!InventoryHolder->ActivateBackpack(ItemData.BackpackSlots, ItemData.BackpackWeightLimit))
+	const FItemDefinition& Definition = ItemData.GetDefinition();
+
+	if (!InventoryHolder->ActivateBackpack(Definition.BackpackSlots, Definition.BackpackWeightLimit))
 	{
 		UE_LOG(LogTFItem, Warning, TEXT("ATFPickupableActor: Failed to activate backpack"));
 		return false;
@@ -192,7 +245,7 @@ bool ATFPickupableActor::HandleBackpackPickup(APawn* Picker)
 	SetActorEnableCollision(false);
 
 	UE_LOG(LogTFItem, Log, TEXT("ATFPickupableActor: Backpack confirm requested (Slots: %d, Weight: %.1f)"),
-		ItemData.BackpackSlots, ItemData.BackpackWeightLimit);
+		Definition.BackpackSlots, Definition.BackpackWeightLimit);
 
 	return false;
 }
@@ -245,6 +298,12 @@ bool ATFPickupableActor::HandleInventoryPickup(APawn* Picker)
 
 bool ATFPickupableActor::Interact(APawn* InstigatorPawn)
 {
+	// Pickup handling (e.g. pending backpack equips) expects a simulated body
+	if (UTFPickupPhysicsSubsystem* PickupPhysics = UTFPickupPhysicsSubsystem::Get(this))
+	{
+		PickupPhysics->WakePickup(this);
+	}
+
 	bool bSuccess = OnPickup(InstigatorPawn);
 
 	if (bSuccess)
@@ -263,11 +322,11 @@ bool ATFPickupableActor::Interact(APawn* InstigatorPawn)
 
 				SetActorEnableCollision(false);
 
-				SetLifeSpan(DestroyDelay);
+				GetWorldTimerManager().SetTimer(ReleaseTimerHandle, this, &ATFPickupableActor::ReleaseToPool, DestroyDelay, false);
 			}
 			else
 			{
-				Destroy();
+				ReleaseToPool();
 			}
 		}
 
@@ -291,7 +350,9 @@ bool ATFPickupableActor::OnPickup(APawn* Picker)
 		return false;
 	}
 
-	if (ItemData.ItemType == EItemType::Backpack)
+	const FItemDefinition& Definition = ItemData.GetDefinition();
+
+	if (Definition.ItemType == EItemType::Backpack)
 	{
 		if (!HandleBackpackPickup(Picker))
 		{
@@ -306,8 +367,8 @@ bool ATFPickupableActor::OnPickup(APawn* Picker)
 		}
 	}
 
-	UE_LOG(LogTFItem, Log, TEXT("Picked up item: %s [Type: %d]"),
-		*ItemData.ItemName.ToString(), static_cast<int32>(ItemData.ItemType));
+	UE_LOGFMT(LogTFItem, Verbose, "ATFPickupableActor: Picked up item '{ItemID}' [Type: {ItemType}]",
+		Definition.ItemID, static_cast<int32>(Definition.ItemType));
 
 	return true;
 }
@@ -325,7 +386,7 @@ bool ATFPickupableActor::CanPickup(APawn* Picker) const
 	}
 
 	// Backpacks can always be picked up
-	if (ItemData.ItemType == EItemType::Backpack)
+	if (GetItemType() == EItemType::Backpack)
 	{
 		return true;
 	}
@@ -356,14 +417,216 @@ void ATFPickupableActor::SetItemData(const FItemData& NewItemData)
 {
 	ItemData = NewItemData;
 
-	// Restore mesh and scale from ItemData when spawned via drop
-	if (MeshComponent && ItemData.ItemMesh)
+	const FItemDefinition& Definition = ItemData.GetDefinition();
+
+	// Restore mesh and scale from the definition when spawned via drop
+	ApplyItemMesh();
+
+	// Restore interaction distance from the definition
+	MaxInteractionDistance = Definition.MaxInteractionDistance;
+}
+
+#pragma region Item Mesh
+
+void ATFPickupableActor::ApplyItemMesh()
+{
+	CancelItemMeshLoad();
+
+	if (!MeshComponent)
 	{
-		MeshComponent->SetStaticMesh(ItemData.ItemMesh);
-		MeshComponent->SetRelativeScale3D(ItemData.ItemMeshScale);
+		return;
 	}
 
-	// Restore interaction distance from ItemData
-	MaxInteractionDistance = ItemData.MaxInteractionDistance;
+	const FItemDefinition& Definition = ItemData.GetDefinition();
+
+	if (UStaticMesh* LoadedMesh = Definition.ItemMesh.Get())
+	{
+		MeshComponent->SetStaticMesh(LoadedMesh);
+		MeshComponent->SetRelativeScale3D(Definition.ItemMeshScale);
+		return;
+	}
+
+	MeshComponent->SetStaticMesh(Definition.ItemType == EItemType::Backpack ? BackpackPlaceholderMesh : ItemPlaceholderMesh);
+	MeshComponent->SetRelativeScale3D(FVector::OneVector);
+
+	if (UTFItemAssetSubsystem* ItemAssets = UTFItemAssetSubsystem::Get(this))
+	{
+		MeshLoadHandle = ItemAssets->RequestItemMesh(Definition.ItemMesh,
+			FStreamableDelegate::CreateUObject(this, &ATFPickupableActor::OnItemMeshLoaded, ItemData.Definition));
+	}
+}
+
+void ATFPickupableActor::OnItemMeshLoaded(const UTFItemDefinition* RequestedDefinition)
+{
+	MeshLoadHandle.Reset();
+
+	// A pooled actor may have been reassigned while the load was in flight
+	if (bInPool || !MeshComponent || ItemData.Definition != RequestedDefinition)
+	{
+		return;
+	}
+
+	const FItemDefinition& Definition = ItemData.GetDefinition();
+	if (UStaticMesh* LoadedMesh = Definition.ItemMesh.Get())
+	{
+		UTFPickupInstancingSubsystem* Instancing = bPhysicsFrozen ? UTFPickupInstancingSubsystem::Get(this) : nullptr;
+		if (Instancing)
+		{
+			Instancing->PromotePickup(this);
+		}
+
+		MeshComponent->SetStaticMesh(LoadedMesh);
+		MeshComponent->SetRelativeScale3D(Definition.ItemMeshScale);
+
+		// Re-instance under the real mesh if the placeholder was instanced
+		if (Instancing)
+		{
+			Instancing->InstancePickup(this);
+		}
+	}
+	else
+	{
+		UE_LOG(LogTFItem, Warning, TEXT("ATFPickupableActor: Failed to load mesh %s for '%s'"),
+			*Definition.ItemMesh.ToString(), *Definition.ItemID.ToString());
+	}
+}
+
+void ATFPickupableActor::CancelItemMeshLoad()
+{
+	if (MeshLoadHandle.IsValid())
+	{
+		MeshLoadHandle->CancelHandle();
+		MeshLoadHandle.Reset();
+	}
+}
+
+#pragma endregion Item Mesh
+
+#pragma region Pooling
+
+void ATFPickupableActor::ReleaseToPool()
+{
+	if (UTFPickupPoolSubsystem* Pool = UTFPickupPoolSubsystem::Get(this))
+	{
+		Pool->ReleasePickup(this);
+	}
+	else
+	{
+		Destroy();
+	}
+}
+
+void ATFPickupableActor::DeactivateToPool()
+{
+	bInPool = true;
+
+	GetWorldTimerManager().ClearTimer(ReleaseTimerHandle);
+	CancelItemMeshLoad();
+
+	if (UTFPickupPhysicsSubsystem* PickupPhysics = UTFPickupPhysicsSubsystem::Get(this))
+	{
+		PickupPhysics->UnregisterPickup(this);
+	}
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+
+	if (MeshComponent)
+	{
+		MeshComponent->SetSimulatePhysics(false);
+
+		// Dropped backpacks re-root onto the mesh and simulation detaches it; restore the original hierarchy
+		if (GetRootComponent() != Root)
+		{
+			SetRootComponent(Root);
+		}
+
+		if (MeshComponent->GetAttachParent() != Root)
+		{
+			MeshComponent->AttachToComponent(Root, FAttachmentTransformRules::KeepRelativeTransform);
+		}
+
+		MeshComponent->SetRelativeTransform(FTransform::Identity);
+		MeshComponent->SetStaticMesh(nullptr);
+		MeshComponent->SetVisibility(true);
+	}
+
+	// After the hierarchy reset: its transform updates would otherwise register the pooled actor again
+	if (UTFInteractableGridSubsystem* Grid = UTFInteractableGridSubsystem::Get(this))
+	{
+		Grid->UnregisterInteractable(this);
+	}
+
+	// Forget anything the previous item or level config set
+	const ATFPickupableActor* Defaults = GetDefault<ATFPickupableActor>();
+	InteractableID = NAME_None;
+	bCanInteract = Defaults->bCanInteract;
+	bDestroyOnPickup = Defaults->bDestroyOnPickup;
+	DestroyDelay = Defaults->DestroyDelay;
+	ItemDefinition = FItemDefinition();
+	ItemData = FItemData();
+	StoredInventoryItems.Reset();
+	SetOwner(nullptr);
+}
+
+void ATFPickupableActor::ActivateFromPool(const FVector& Location)
+{
+	bInPool = false;
+
+	SetActorLocationAndRotation(Location, FRotator::ZeroRotator, false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	if (MeshComponent)
+	{
+		ApplyPickupCollision();
+		MeshComponent->SetSimulatePhysics(true);
+	}
+
+	UpdateGridEntry();
+
+	if (UTFPickupPhysicsSubsystem* PickupPhysics = UTFPickupPhysicsSubsystem::Get(this))
+	{
+		PickupPhysics->RegisterPickup(this);
+	}
+}
+
+#pragma endregion Pooling
+
+#pragma region Physics Freeze
+
+void ATFPickupableActor::SetPhysicsFrozen(bool bFrozen)
+{
+	if (!MeshComponent || bPhysicsFrozen == bFrozen)
+	{
+		return;
+	}
+
+	bPhysicsFrozen = bFrozen;
+
+	UTFPickupInstancingSubsystem* Instancing = UTFPickupInstancingSubsystem::Get(this);
+
+	if (bFrozen)
+	{
+		MeshComponent->SetSimulatePhysics(false);
+		MeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+
+		// Resting and far from players: draw as part of a shared instanced cluster
+		if (Instancing)
+		{
+			Instancing->InstancePickup(this);
+		}
+	}
+	else
+	{
+		if (Instancing)
+		{
+			Instancing->PromotePickup(this);
+		}
+
+		MeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+		MeshComponent->SetSimulatePhysics(true);
+	}
 }
 
+#pragma endregion Physics Freeze
@@ -8,6 +8,7 @@
 #include "TFBaseContainerActor.generated.h"
 
 class UUserWidget;
+struct FTFContainerConfig;
 
 UCLASS()
 class TFWORLDACTORS_API ATFBaseContainerActor : public ATFInteractableActor, public ITFContainerInterface
@@ -52,6 +53,8 @@ protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void LoadConfigFromINI() override;
+	void ApplyContainerConfig(const FTFContainerConfig& Config);
+	virtual void OnConfigReloaded(const FTFConfigDelta& Delta) override;
 
 public:
 
@@ -72,6 +75,8 @@ public:
 	virtual bool ContainerHasSpace() const override;
 	virtual bool AddItemToContainer(const FItemData& Item) override;
 	virtual bool RemoveItemFromContainer(FName ItemID) override;
+	virtual bool AddItemsToContainer(TConstArrayView<FItemData> NewItems) override;
+	virtual int32 RemoveContainerItemsAt(TConstArrayView<int32> Indices, TArray<FItemData>& OutRemoved) override;
 	virtual const FItemData* GetContainerItem(FName ItemID) const override;
 	virtual FText GetContainerName() const override { return ContainerDisplayName; }
 	virtual void CloseContainer() override;
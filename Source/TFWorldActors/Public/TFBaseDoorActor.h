@@ -8,6 +8,7 @@
 
 class UAudioComponent;
 class APawn;
+struct FTFDoorConfig;
 
 UENUM()
 enum class EDoorState : uint8
@@ -76,8 +77,6 @@ protected:
 	float CurrentAngle = 0.0f;
 
 	float TargetAngle = 0.0f;
-	float AnimationTimer = 0.0f;
-	float CurrentAnimationDuration = 0.0f;
 	FRotator InitialRotation;
 	FTimerHandle AutoCloseTimerHandle;
 
@@ -98,11 +97,12 @@ protected:
 
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-	virtual void Tick(float DeltaTime) override;
 
 	/** Load door configuration from INI file based on InteractableID */
 	virtual void LoadConfigFromINI() override;
-	void UpdateDoorAnimation(float DeltaTime);
+	void ApplyDoorConfig(const FTFDoorConfig& Config);
+	virtual void OnConfigReloaded(const FTFConfigDelta& Delta) override;
+	void StartDoorAnimation(float StartAngle, float EndAngle, float Duration);
 	void ApplyDoorRotation(float Angle);
 	float CalculateTargetAngle(const FVector& PlayerLocation);
 	virtual void StartOpening(APawn* OpeningCharacter);
@@ -114,6 +114,14 @@ protected:
 	void StopDoorMovementSound();
 	void AutoCloseDoor();
 
+	friend class UTFDoorAnimationSubsystem;
+
+	/** Called by the animation subsystem with this frame's eased angle */
+	void SetAnimatedAngle(float Angle);
+
+	/** Called by the animation subsystem after the batch in which this door finished */
+	void FinishDoorAnimation();
+
 public:
 
 	ATFBaseDoorActor();
@@ -0,0 +1,24 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "TFConfigCookCommandlet.generated.h"
+
+/**
+ * Validates the TF INI files and compiles them into the binary blob loaded by UTFConfigSubsystem.
+ * Run before packaging: UnrealEditor-Cmd TheFall.uproject -run=TFConfigCook [-Output=<path>]
+ * With -Verify nothing is written; returns non-zero if the blob is missing or older than the INI files.
+ */
+UCLASS()
+class TFWORLDACTORS_API UTFConfigCookCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UTFConfigCookCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
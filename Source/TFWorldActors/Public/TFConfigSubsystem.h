@@ -0,0 +1,173 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "TFPickupableInterface.h"
+#include "TFBaseDoorActor.h"
+#include "TFConfigSubsystem.generated.h"
+
+/** [InteractableID] section of InteractableConfig.ini. Unset fields keep the actor's own values. */
+struct FTFInteractableConfig
+{
+	TOptional<float> MaxInteractionDistance;
+	TOptional<bool> bCanInteract;
+};
+
+/** [ItemID] section of ItemConfig.ini */
+struct FTFItemConfig
+{
+	TOptional<EItemType> ItemType;
+	TOptional<FText> ItemName;
+	TOptional<FText> ItemDescription;
+	TOptional<float> Weight;
+	TOptional<float> HungerRestore;
+	TOptional<float> ThirstRestore;
+	TOptional<int32> BackpackSlots;
+	TOptional<float> BackpackWeightLimit;
+	TOptional<bool> bDestroyOnPickup;
+	TOptional<float> DestroyDelay;
+	TOptional<float> MaxInteractionDistance;
+
+	/** Null when the section does not override the editor-assigned mesh */
+	TSoftObjectPtr<UStaticMesh> ItemMesh;
+};
+
+/** [DoorID] section of DoorConfig.ini */
+struct FTFDoorConfig
+{
+	TOptional<EDoorHinge> HingeType;
+	TOptional<float> MaxOpenAngle;
+	TOptional<float> OpenDuration;
+	TOptional<float> CloseDuration;
+	TOptional<bool> bAutoClose;
+	TOptional<float> AutoCloseDelay;
+};
+
+/** [ContainerID] section of ContainerConfig.ini */
+struct FTFContainerConfig
+{
+	TOptional<int32> MaxCapacity;
+	TOptional<FText> ContainerName;
+};
+
+/** Fields of a section that changed on hot reload; only set fields are applied */
+struct FTFConfigDelta
+{
+	const FTFInteractableConfig* Interactable = nullptr;
+	const FTFItemConfig* Item = nullptr;
+	const FTFDoorConfig* Door = nullptr;
+	const FTFContainerConfig* Container = nullptr;
+};
+
+/**
+ * Parses the data-driven INI files once per game instance into immutable
+ * FName-keyed tables, so world actors resolve their config with a hash lookup.
+ * Also owns the shared item definitions referenced by FItemData instances.
+ */
+UCLASS()
+class TFWORLDACTORS_API UTFConfigSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+private:
+
+#pragma region Definition Tables
+
+	TMap<FName, FTFInteractableConfig> InteractableConfigs;
+	TMap<FName, FTFItemConfig> ItemConfigs;
+	TMap<FName, FTFDoorConfig> DoorConfigs;
+	TMap<FName, FTFContainerConfig> ContainerConfigs;
+
+#pragma endregion Definition Tables
+
+#pragma region Item Definitions
+
+	/** Interned definitions; instances with identical item data share one object */
+	UPROPERTY()
+	TArray<UTFItemDefinition*> ItemDefinitions;
+
+	TMultiMap<FName, UTFItemDefinition*> ItemDefinitionIndex;
+
+#pragma endregion Item Definitions
+
+#pragma region Parsing
+
+	/** Unknown enum values and malformed asset paths seen by the last parse */
+	int32 NumParseErrors = 0;
+
+	void LoadInteractableConfigs();
+	void LoadItemConfigs();
+	void LoadDoorConfigs();
+	void LoadContainerConfigs();
+
+#pragma endregion Parsing
+
+#pragma region Cooked Config
+
+	/** Reads or writes every definition table; the same code path cooks and loads */
+	void SerializeTables(FArchive& Ar);
+
+#pragma endregion Cooked Config
+
+#if WITH_EDITOR
+#pragma region Hot Reload
+
+	FDelegateHandle ConfigWatcherHandle;
+
+	void StartConfigWatcher();
+	void StopConfigWatcher();
+	void OnConfigDirectoryChanged(const TArray<struct FFileChangeData>& Changes);
+	void ReloadConfigFile(const FString& FileName);
+
+	/** Re-parses one table and applies the changed fields to live actors with a matching InteractableID */
+	template <typename ConfigType>
+	void ReloadTable(const FString& FileName, TMap<FName, ConfigType>& Table, void (UTFConfigSubsystem::*LoadTable)(), const ConfigType* FTFConfigDelta::*DeltaField);
+
+#pragma endregion Hot Reload
+#endif
+
+public:
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	static UTFConfigSubsystem* Get(const UObject* WorldContextObject);
+
+#pragma region Lookup
+
+	const FTFInteractableConfig* FindInteractableConfig(FName InteractableID) const { return InteractableConfigs.Find(InteractableID); }
+	const FTFItemConfig* FindItemConfig(FName ItemID) const { return ItemConfigs.Find(ItemID); }
+	const FTFDoorConfig* FindDoorConfig(FName DoorID) const { return DoorConfigs.Find(DoorID); }
+	const FTFContainerConfig* FindContainerConfig(FName ContainerID) const { return ContainerConfigs.Find(ContainerID); }
+
+#pragma endregion Lookup
+
+#pragma region Cooked Config
+
+	/** Content/Data/TFConfig.bin; staged with the game and preferred outside the editor while it matches the INI files it was cooked from */
+	static FString GetCookedConfigPath();
+
+	/** Parses every TF INI file into the definition tables; returns false if any value failed validation */
+	bool ParseINIFiles();
+
+	bool SaveCookedConfigs(const FString& FilePath);
+
+	/** Falls back to the INI files (returns false) if the blob is missing, of another version, or, outside shipping, older than the INI files */
+	bool LoadCookedConfigs(const FString& FilePath);
+
+	/** Header-only check that the blob exists and was cooked from the current INI files */
+	static bool IsCookedConfigCurrent(const FString& FilePath);
+
+	int32 GetNumParseErrors() const { return NumParseErrors; }
+
+#pragma endregion Cooked Config
+
+#pragma region Item Definitions
+
+	/** Returns the shared definition matching this data, creating it on first use */
+	const UTFItemDefinition* InternItemDefinition(const FItemDefinition& Definition);
+
+#pragma endregion Item Definitions
+};
@@ -0,0 +1,52 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TFDoorAnimationSubsystem.generated.h"
+
+class ATFBaseDoorActor;
+
+/**
+ * Animates every moving door in one pass per frame.
+ * Angles are eased for all doors first, rotations are pushed next,
+ * and completion events fire once the batch has been applied.
+ */
+UCLASS()
+class TFWORLDACTORS_API UTFDoorAnimationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+
+#pragma region Moving Doors
+
+	UPROPERTY()
+	TArray<ATFBaseDoorActor*> Doors;
+
+	TArray<float> StartAngles;
+	TArray<float> EndAngles;
+	TArray<float> Elapsed;
+	TArray<float> Durations;
+	TArray<float> Angles;
+
+#pragma endregion Moving Doors
+
+	void RemoveAt(int32 Index);
+
+public:
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool IsTickable() const override { return Doors.Num() > 0; }
+
+	/** Starts (or restarts) animating Door from StartAngle to EndAngle */
+	void StartAnimation(ATFBaseDoorActor* Door, float StartAngle, float EndAngle, float Duration);
+
+	/** Removes Door without firing its completion */
+	void StopAnimation(ATFBaseDoorActor* Door);
+
+	int32 GetNumMovingDoors() const { return Doors.Num(); }
+};
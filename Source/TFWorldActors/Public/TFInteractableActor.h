@@ -9,6 +9,8 @@
 
 class UStaticMeshComponent;
 class USceneComponent;
+struct FTFConfigDelta;
+struct FTFInteractableConfig;
 
 
 UCLASS()
@@ -49,8 +51,33 @@ protected:
 #pragma endregion Interaction Settings
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void LoadConfigFromINI();
 
+	/** Applies the fields set in Config; unset fields keep their current values */
+	void ApplyInteractableConfig(const FTFInteractableConfig& Config);
+
+	/** Config hot reload hook; subclasses apply their own table's delta */
+	virtual void OnConfigReloaded(const FTFConfigDelta& Delta);
+
+#pragma region Spatial Grid
+
+	/** Distance the mesh may move before the grid entry is pushed again; the pushed radius is padded by it */
+	static constexpr float GridMoveSlack = 50.0f;
+
+	/** Push current bounds to the interactable grid */
+	void UpdateGridEntry();
+
+	/** Re-pushes the grid entry only once the mesh has moved further than GridMoveSlack */
+	void OnMeshTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	FDelegateHandle MeshTransformUpdatedHandle;
+
+	/** Mesh bounds origin when the grid entry was last pushed */
+	FVector GridMeshOrigin = FVector::ZeroVector;
+
+#pragma endregion Spatial Grid
+
 public:
 
 	ATFInteractableActor();
@@ -76,5 +103,8 @@ public:
 	void SetCanInteract(bool bNewCanInteract);
 	FORCEINLINE FName GetInteractableID() const { return InteractableID; }
 
+	/** Called by UTFConfigSubsystem when an INI section for this InteractableID changes */
+	void ApplyReloadedConfig(const FTFConfigDelta& Delta);
+
 #pragma endregion Accessors
 };
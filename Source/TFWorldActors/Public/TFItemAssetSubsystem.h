@@ -0,0 +1,51 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "TFItemAssetSubsystem.generated.h"
+
+class UStaticMesh;
+
+/**
+ * Streams item meshes referenced by soft pointer in FItemDefinition.
+ * Keeps meshes of carried items resident so dropping them never loads on the game thread.
+ */
+UCLASS()
+class TFWORLDACTORS_API UTFItemAssetSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+private:
+
+	FStreamableManager StreamableManager;
+
+	struct FPreloadedMesh
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+		int32 RefCount = 0;
+	};
+
+	/** Meshes of items currently carried by the player, held while referenced */
+	TMap<FSoftObjectPath, FPreloadedMesh> PreloadedMeshes;
+
+public:
+
+	virtual void Deinitialize() override;
+
+	static UTFItemAssetSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Calls OnLoaded once the mesh is resident; immediately if it already is.
+	 * Returns the in-flight handle, or nullptr if no async load was needed.
+	 */
+	TSharedPtr<FStreamableHandle> RequestItemMesh(const TSoftObjectPtr<UStaticMesh>& Mesh, FStreamableDelegate OnLoaded);
+
+	/** Keeps Mesh loaded until every AddPreloadedMesh is matched by a RemovePreloadedMesh */
+	void AddPreloadedMesh(const FSoftObjectPath& Mesh);
+	void RemovePreloadedMesh(const FSoftObjectPath& Mesh);
+
+	int32 GetNumPreloadedMeshes() const { return PreloadedMeshes.Num(); }
+};
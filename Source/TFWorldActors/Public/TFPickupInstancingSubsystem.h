@@ -0,0 +1,81 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TFPickupInstancingSubsystem.generated.h"
+
+class ATFPickupableActor;
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+/**
+ * Draws frozen pickups that share a mesh as instances of one UInstancedStaticMeshComponent per cell.
+ * The pickup actor keeps its query collision for interaction traces; only its own mesh is hidden.
+ * Pickups are promoted back to their own mesh when they thaw.
+ */
+UCLASS(Config = Game)
+class TFWORLDACTORS_API UTFPickupInstancingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+
+	UPROPERTY(Config)
+	bool bEnableInstancing = true;
+
+	/** Edge length of the cells instances are grouped by, so culling stays effective */
+	UPROPERTY(Config)
+	float CellSize = 5000.0f;
+
+	struct FClusterKey
+	{
+		FIntVector Cell;
+		const UStaticMesh* Mesh;
+
+		bool operator==(const FClusterKey& Other) const { return Cell == Other.Cell && Mesh == Other.Mesh; }
+		friend uint32 GetTypeHash(const FClusterKey& Key) { return HashCombine(GetTypeHash(Key.Cell), GetTypeHash(Key.Mesh)); }
+	};
+
+	struct FCluster
+	{
+		UInstancedStaticMeshComponent* Component = nullptr;
+
+		/** Pickup drawn by each instance index */
+		TArray<TWeakObjectPtr<ATFPickupableActor>> InstanceOwners;
+	};
+
+	/** Owns every cluster component */
+	UPROPERTY()
+	AActor* InstanceHost = nullptr;
+
+	/** Cluster components, kept alive for GC; Clusters holds the lookup */
+	UPROPERTY()
+	TArray<UInstancedStaticMeshComponent*> ClusterComponents;
+
+	TMap<FClusterKey, FCluster> Clusters;
+	TMap<TObjectKey<ATFPickupableActor>, FClusterKey> InstancedPickups;
+
+	FCluster* FindOrAddCluster(const FClusterKey& Key, UStaticMesh* Mesh);
+	FIntVector GetCell(const FVector& Location) const;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+
+	virtual void Deinitialize() override;
+
+	static UTFPickupInstancingSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Hides the pickup's mesh and draws it as an instance; returns false if it cannot be instanced */
+	bool InstancePickup(ATFPickupableActor* Pickup);
+
+	/** Removes the pickup's instance and shows its own mesh again */
+	void PromotePickup(ATFPickupableActor* Pickup);
+
+	int32 GetNumInstancedPickups() const { return InstancedPickups.Num(); }
+	int32 GetNumClusters() const { return Clusters.Num(); }
+};
@@ -0,0 +1,81 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TFPickupPhysicsSubsystem.generated.h"
+
+class ATFPickupableActor;
+
+/**
+ * Freezes resting pickups to kinematic, query-only bodies once they have slept
+ * long enough away from every player, and thaws them when a player comes close
+ * or something nearby needs them to react again.
+ */
+UCLASS(Config = Game)
+class TFWORLDACTORS_API UTFPickupPhysicsSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+
+#pragma region Settings
+
+	/** Seconds between freeze/thaw passes */
+	UPROPERTY(Config)
+	float CheckInterval = 1.0f;
+
+	/** Seconds a body must have been asleep before it is frozen */
+	UPROPERTY(Config)
+	float FreezeSleepTime = 5.0f;
+
+	/** Pickups closer than this to a player are never frozen */
+	UPROPERTY(Config)
+	float FreezeRadius = 2000.0f;
+
+	/** Frozen pickups closer than this to a player are thawed; smaller than FreezeRadius to avoid flip-flopping */
+	UPROPERTY(Config)
+	float ThawRadius = 1500.0f;
+
+#pragma endregion Settings
+
+	struct FTrackedPickup
+	{
+		TWeakObjectPtr<ATFPickupableActor> Pickup;
+		float SleepTime = 0.0f;
+		bool bFrozen = false;
+	};
+
+	TMap<TObjectKey<ATFPickupableActor>, FTrackedPickup> TrackedPickups;
+
+	int32 NumFrozen = 0;
+
+	FTimerHandle CheckTimerHandle;
+
+	void RunFreezePass();
+	void SetFrozen(FTrackedPickup& Entry, ATFPickupableActor& Pickup, bool bFrozen);
+	void UpdateBodyStats() const;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+
+	virtual void Deinitialize() override;
+
+	static UTFPickupPhysicsSubsystem* Get(const UObject* WorldContextObject);
+
+	void RegisterPickup(ATFPickupableActor* Pickup);
+	void UnregisterPickup(ATFPickupableActor* Pickup);
+
+	/** Thaws the pickup if it is frozen; call before touching its physics state */
+	void WakePickup(ATFPickupableActor* Pickup);
+
+	/** Thaws frozen pickups within Radius, e.g. before applying an impulse nearby */
+	void WakePickupsNear(const FVector& Location, float Radius);
+
+	int32 GetNumTrackedPickups() const { return TrackedPickups.Num(); }
+	int32 GetNumFrozenPickups() const { return NumFrozen; }
+};
@@ -0,0 +1,54 @@
+// Copyright TF Project. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TFPickupPoolSubsystem.generated.h"
+
+class ATFPickupableActor;
+
+/**
+ * Recycles ATFPickupableActor instances for dropped items and backpacks.
+ * Picked-up actors are hidden and parked here instead of being destroyed;
+ * drops reuse them and reinitialize them through SetItemData.
+ */
+UCLASS(Config = Game)
+class TFWORLDACTORS_API UTFPickupPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+
+	/** Actors spawned into the pool when the level starts */
+	UPROPERTY(Config)
+	int32 PrewarmCount = 8;
+
+	/** Upper bound on parked actors; extra releases are destroyed */
+	UPROPERTY(Config)
+	int32 MaxPoolSize = 64;
+
+	UPROPERTY()
+	TArray<ATFPickupableActor*> FreePickups;
+
+	ATFPickupableActor* SpawnPooledActor(UWorld& World);
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	static UTFPickupPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Returns an active pickup at Location, reusing a parked actor when available */
+	ATFPickupableActor* AcquirePickup(const FVector& Location, AActor* Owner);
+
+	/** Parks the pickup for reuse; returns false if it was destroyed instead */
+	bool ReleasePickup(ATFPickupableActor* Pickup);
+
+	int32 GetNumFreePickups() const { return FreePickups.Num(); }
+};
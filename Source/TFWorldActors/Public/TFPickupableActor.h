@@ -5,8 +5,11 @@
 #include "CoreMinimal.h"
 #include "TFInteractableActor.h"
 #include "TFPickupableInterface.h"
+#include "Engine/StreamableManager.h"
 #include "TFPickupableActor.generated.h"
 
+struct FTFItemConfig;
+
 UCLASS()
 class TFWORLDACTORS_API ATFPickupableActor : public ATFInteractableActor, public ITFPickupableInterface
 {
@@ -16,11 +19,34 @@ protected:
 
 #pragma region Item Data
 
+	/** Authored item data; resolved into a shared definition at BeginPlay */
 	UPROPERTY(EditAnywhere, Category = "Item", meta = (EditCondition = "!bUseDataDrivenConfig", EditConditionHides))
+	FItemDefinition ItemDefinition;
+
+	/** Runtime instance; never saved, since saved ItemData tags are redirected to ItemDefinition */
+	UPROPERTY(VisibleAnywhere, Transient, Category = "Item")
 	FItemData ItemData;
 
 #pragma endregion Item Data
 
+#pragma region Item Mesh
+
+	/** Shown while an item's mesh streams in, or when it has none */
+	UPROPERTY(EditDefaultsOnly, Category = "Item|Mesh")
+	UStaticMesh* ItemPlaceholderMesh = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Item|Mesh")
+	UStaticMesh* BackpackPlaceholderMesh = nullptr;
+
+	TSharedPtr<FStreamableHandle> MeshLoadHandle;
+
+	/** Sets the definition's mesh if resident, otherwise a placeholder and starts streaming it */
+	void ApplyItemMesh();
+	void OnItemMeshLoaded(const UTFItemDefinition* RequestedDefinition);
+	void CancelItemMeshLoad();
+
+#pragma endregion Item Mesh
+
 #pragma region Pickup Settings
 
 	UPROPERTY(EditAnywhere, Category = "Pickup", meta = (EditCondition = "!bUseDataDrivenConfig", EditConditionHides))
@@ -38,8 +64,24 @@ protected:
 
 #pragma endregion Backpack Storage
 
+#pragma region Pooling
+
+	FTimerHandle ReleaseTimerHandle;
+
+	bool bInPool = false;
+
+	bool bPhysicsFrozen = false;
+
+	/** Collision profile of a resting pickup; also restored when leaving the pool */
+	void ApplyPickupCollision();
+
+#pragma endregion Pooling
+
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void LoadConfigFromINI() override;
+	void ApplyItemConfig(const FTFItemConfig& Config);
+	virtual void OnConfigReloaded(const FTFConfigDelta& Delta) override;
 	bool HandleBackpackPickup(APawn* Picker);
 	bool HandleInventoryPickup(APawn* Picker);
 
@@ -78,7 +120,34 @@ public:
 	void SetStoredInventoryItems(const TArray<FItemData>& Items) { StoredInventoryItems = Items; }
 	const TArray<FItemData>& GetStoredInventoryItems() const { return StoredInventoryItems; }
 
-	FORCEINLINE EItemType GetItemType() const { return ItemData.ItemType; }
+	FORCEINLINE EItemType GetItemType() const { return ItemData.GetDefinition().ItemType; }
 
 #pragma endregion Accessors
+
+#pragma region Pooling
+
+	/** Return to the world pickup pool, or destroy if there is none */
+	void ReleaseToPool();
+
+	/** Called by UTFPickupPoolSubsystem; resets the actor to a hidden, inert state */
+	void DeactivateToPool();
+
+	/** Called by UTFPickupPoolSubsystem before the new item data is set */
+	void ActivateFromPool(const FVector& Location);
+
+	bool IsInPool() const { return bInPool; }
+
+#pragma endregion Pooling
+
+#pragma region Physics Freeze
+
+	/**
+	 * Called by UTFPickupPhysicsSubsystem; swaps between a simulated body and a kinematic, query-only one.
+	 * Frozen pickups are drawn through UTFPickupInstancingSubsystem when possible.
+	 */
+	void SetPhysicsFrozen(bool bFrozen);
+
+	bool IsPhysicsFrozen() const { return bPhysicsFrozen; }
+
+#pragma endregion Physics Freeze
 };
@@ -27,5 +27,11 @@ public class TFWorldActors : ModuleRules
 			}
 			);
 
+		if (Target.bBuildEditor)
+		{
+			// Config hot reload while iterating in PIE
+			PrivateDependencyModuleNames.Add("DirectoryWatcher");
+		}
+
 	}
 }
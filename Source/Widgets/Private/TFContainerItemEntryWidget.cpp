@@ -29,8 +29,7 @@ void UTFContainerItemEntryWidget::NativeOnListItemObjectSet(UObject* ListItemObj
 
 	if (ItemNameText)
 	{
-		const FItemData& Data = CachedViewData->ItemData;
-		ItemNameText->SetText(Data.ItemName);
+		ItemNameText->SetText(CachedViewData->ItemData.GetDefinition().ItemName);
 	}
 
 	if (ActionButtonText)
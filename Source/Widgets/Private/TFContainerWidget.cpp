@@ -1,7 +1,6 @@
 // Copyright TF Project. All Rights Reserved.
 
 #include "TFContainerWidget.h"
-#include "TFContainerItemViewData.h"
 #include "TFInventoryComponent.h"
 #include "TFPlayerCharacter.h"
 
@@ -19,6 +18,16 @@ void UTFContainerWidget::NativeConstruct()
 		CloseButton->OnClicked.AddUniqueDynamic(this, &UTFContainerWidget::OnCloseClicked);
 	}
 
+	if (TakeAllButton)
+	{
+		TakeAllButton->OnClicked.AddUniqueDynamic(this, &UTFContainerWidget::OnTakeAllClicked);
+	}
+
+	if (DepositAllButton)
+	{
+		DepositAllButton->OnClicked.AddUniqueDynamic(this, &UTFContainerWidget::OnDepositAllClicked);
+	}
+
 	InitializeInventoryComponent();
 
 	if (FTFContainerContext::ActiveContainer)
@@ -38,6 +47,7 @@ void UTFContainerWidget::NativeDestruct()
 	{
 		CachedInventoryComponent->OnItemAdded.RemoveAll(this);
 		CachedInventoryComponent->OnItemRemoved.RemoveAll(this);
+		CachedInventoryComponent->OnItemsChanged.RemoveAll(this);
 	}
 
 	Super::NativeDestruct();
@@ -62,6 +72,7 @@ void UTFContainerWidget::InitializeInventoryComponent()
 	{
 		CachedInventoryComponent->OnItemAdded.AddUObject(this, &UTFContainerWidget::OnInventoryItemAdded);
 		CachedInventoryComponent->OnItemRemoved.AddUObject(this, &UTFContainerWidget::OnInventoryItemRemoved);
+		CachedInventoryComponent->OnItemsChanged.AddUObject(this, &UTFContainerWidget::OnInventoryItemsChanged);
 	}
 }
 
@@ -95,61 +106,146 @@ void UTFContainerWidget::SetContainerSource(ITFContainerInterface* Container)
 	RefreshDisplay();
 }
 
-void UTFContainerWidget::PopulateContainerList()
+UTFContainerItemViewData* UTFContainerWidget::AcquireViewData(const FItemData& Item, EContainerItemSource Source, FInventoryItemHandle Handle)
 {
-	if (!ContainerListView)
+	UTFContainerItemViewData* ViewData = ViewDataPool.Num() > 0
+		? ViewDataPool.Pop(EAllowShrinking::No)
+		: NewObject<UTFContainerItemViewData>(this);
+
+	ViewData->ItemData = Item;
+	ViewData->Source = Source;
+	ViewData->Handle = Handle;
+	ViewData->OwnerWidget = this;
+
+	return ViewData;
+}
+
+void UTFContainerWidget::ReleaseViewData(UTFContainerItemViewData* ViewData)
+{
+	if (ViewData)
 	{
-		return;
+		ViewData->ItemData = FItemData();
+		ViewData->Handle = FInventoryItemHandle();
+		ViewDataPool.Add(ViewData);
 	}
+}
 
-	ContainerListView->ClearListItems();
-	ContainerListItems.Empty();
+void UTFContainerWidget::SyncListItems(UListView* ListView, TArray<UTFContainerItemViewData*>& ListItems, const TArray<FItemData>& Items, EContainerItemSource Source)
+{
+	// Unmatched source indices per item; entries with the same ID and definition are interchangeable
+	TMap<FName, TArray<int32, TInlineAllocator<4>>> Unmatched;
+	Unmatched.Reserve(Items.Num());
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		Unmatched.FindOrAdd(Items[Index].ItemID).Add(Index);
+	}
 
-	if (!CachedContainer)
+	for (int32 i = ListItems.Num() - 1; i >= 0; --i)
 	{
-		return;
+		UTFContainerItemViewData* ViewData = ListItems[i];
+		auto* Candidates = ViewData ? Unmatched.Find(ViewData->ItemData.ItemID) : nullptr;
+		const int32 Match = Candidates
+			? Candidates->IndexOfByPredicate([&](int32 Index) { return Items[Index].Definition == ViewData->ItemData.Definition; })
+			: INDEX_NONE;
+
+		if (Match != INDEX_NONE)
+		{
+			Candidates->RemoveAtSwap(Match);
+			continue;
+		}
+
+		ListView->RemoveItem(ViewData);
+		ListItems.RemoveAt(i);
+		ReleaseViewData(ViewData);
+	}
+
+	// Append new rows in source order, not map order
+	TArray<int32> NewIndices;
+	for (const TPair<FName, TArray<int32, TInlineAllocator<4>>>& Pair : Unmatched)
+	{
+		NewIndices.Append(Pair.Value);
 	}
+	NewIndices.Sort();
 
-	const TArray<FItemData>& Items = CachedContainer->GetContainerItems();
+	for (const int32 Index : NewIndices)
+	{
+		UTFContainerItemViewData* ViewData = AcquireViewData(Items[Index], Source);
+		ListItems.Add(ViewData);
+		ListView->AddItem(ViewData);
+	}
+}
 
-	for (const FItemData& Item : Items)
+void UTFContainerWidget::AddNewestInventoryRows(int32 Count)
+{
+	if (!InventoryListView || !CachedInventoryComponent || Count <= 0)
 	{
-		UTFContainerItemViewData* ViewData = NewObject<UTFContainerItemViewData>(this);
-		ViewData->ItemData = Item;
-		ViewData->Source = EContainerItemSource::Container;
-		ViewData->OwnerWidget = this;
+		return;
+	}
+
+	TArray<FInventoryItemHandle> Handles;
+	CachedInventoryComponent->GetNewestHandles(Count, Handles);
 
-		ContainerListItems.Add(ViewData);
-		ContainerListView->AddItem(ViewData);
+	for (const FInventoryItemHandle Handle : Handles)
+	{
+		UTFContainerItemViewData* ViewData = AcquireViewData(*CachedInventoryComponent->GetItemByHandle(Handle), EContainerItemSource::Inventory, Handle);
+		InventoryListItems.Add(ViewData);
+		InventoryListView->AddItem(ViewData);
 	}
 }
 
-void UTFContainerWidget::PopulateInventoryList()
+void UTFContainerWidget::RemoveStaleInventoryRows(FName ItemID)
 {
 	if (!InventoryListView)
 	{
 		return;
 	}
 
-	InventoryListView->ClearListItems();
-	InventoryListItems.Empty();
+	for (int32 i = InventoryListItems.Num() - 1; i >= 0; --i)
+	{
+		UTFContainerItemViewData* ViewData = InventoryListItems[i];
+		if (CachedInventoryComponent && ViewData && CachedInventoryComponent->IsValidHandle(ViewData->Handle))
+		{
+			continue;
+		}
+
+		// One removal leaves exactly one stale row
+		const bool bFound = !ItemID.IsNone() && ViewData && ViewData->ItemData.ItemID == ItemID;
 
-	if (!CachedInventoryComponent)
+		InventoryListView->RemoveItem(ViewData);
+		InventoryListItems.RemoveAt(i);
+		ReleaseViewData(ViewData);
+
+		if (bFound)
+		{
+			break;
+		}
+	}
+}
+
+void UTFContainerWidget::PopulateContainerList()
+{
+	if (!ContainerListView)
 	{
 		return;
 	}
 
-	const TArray<FItemData>& Items = CachedInventoryComponent->GetItems();
+	static const TArray<FItemData> NoItems;
+	SyncListItems(ContainerListView, ContainerListItems, CachedContainer ? CachedContainer->GetContainerItems() : NoItems, EContainerItemSource::Container);
+}
 
-	for (const FItemData& Item : Items)
+void UTFContainerWidget::PopulateInventoryList()
+{
+	if (!InventoryListView)
 	{
-		UTFContainerItemViewData* ViewData = NewObject<UTFContainerItemViewData>(this);
-		ViewData->ItemData = Item;
-		ViewData->Source = EContainerItemSource::Inventory;
-		ViewData->OwnerWidget = this;
+		return;
+	}
 
-		InventoryListItems.Add(ViewData);
-		InventoryListView->AddItem(ViewData);
+	// Rows track items by handle: drop the ones whose item is gone, then append what was added since
+	RemoveStaleInventoryRows();
+
+	if (CachedInventoryComponent)
+	{
+		AddNewestInventoryRows(CachedInventoryComponent->GetUsedSlots() - InventoryListItems.Num());
 	}
 }
 
@@ -189,13 +285,25 @@ void UTFContainerWidget::OnContainerChanged()
 
 void UTFContainerWidget::OnInventoryItemAdded(const FItemData& Item)
 {
-	PopulateInventoryList();
+	AddNewestInventoryRows(1);
 	UpdateInventorySlotsDisplay();
 }
 
 void UTFContainerWidget::OnInventoryItemRemoved(FName ItemID)
 {
-	PopulateInventoryList();
+	RemoveStaleInventoryRows(ItemID);
+	UpdateInventorySlotsDisplay();
+}
+
+void UTFContainerWidget::OnInventoryItemsChanged(const FTFItemDelta& Delta)
+{
+	// Apply the batch directly; the full sync is left to RefreshDisplay
+	if (!Delta.Removed.IsEmpty())
+	{
+		RemoveStaleInventoryRows();
+	}
+
+	AddNewestInventoryRows(Delta.Added.Num());
 	UpdateInventorySlotsDisplay();
 }
 
@@ -207,6 +315,16 @@ void UTFContainerWidget::OnCloseClicked()
 	}
 }
 
+void UTFContainerWidget::OnTakeAllClicked()
+{
+	TakeAllItems();
+}
+
+void UTFContainerWidget::OnDepositAllClicked()
+{
+	DepositAllItems();
+}
+
 void UTFContainerWidget::RefreshDisplay()
 {
 	PopulateContainerList();
@@ -217,56 +335,32 @@ void UTFContainerWidget::RefreshDisplay()
 
 void UTFContainerWidget::TakeItem(FName ItemID)
 {
-	if (!CachedContainer || !CachedInventoryComponent)
-	{
-		return;
-	}
-
-	const FItemData* Item = CachedContainer->GetContainerItem(ItemID);
-	if (!Item)
+	if (CachedContainer && CachedInventoryComponent)
 	{
-		return;
-	}
-
-	if (!CachedInventoryComponent->HasSpaceForItem(*Item))
-	{
-		return;
+		CachedInventoryComponent->TakeFromContainer(*CachedContainer, MakeArrayView(&ItemID, 1));
 	}
-
-	FItemData ItemCopy = *Item;
-
-	if (!CachedContainer->RemoveItemFromContainer(ItemID))
-	{
-		return;
-	}
-
-	CachedInventoryComponent->AddItem(ItemCopy);
 }
 
 void UTFContainerWidget::DepositItem(FName ItemID)
 {
-	if (!CachedContainer || !CachedInventoryComponent)
+	if (CachedContainer && CachedInventoryComponent)
 	{
-		return;
+		CachedInventoryComponent->DepositToContainer(*CachedContainer, MakeArrayView(&ItemID, 1));
 	}
+}
 
-	if (!CachedContainer->ContainerHasSpace())
+void UTFContainerWidget::TakeAllItems()
+{
+	if (CachedContainer && CachedInventoryComponent)
 	{
-		return;
+		CachedInventoryComponent->TakeFromContainer(*CachedContainer);
 	}
+}
 
-	const FItemData* Item = CachedInventoryComponent->GetItem(ItemID);
-	if (!Item)
-	{
-		return;
-	}
-
-	FItemData ItemCopy = *Item;
-
-	if (!CachedInventoryComponent->RemoveItem(ItemID))
+void UTFContainerWidget::DepositAllItems()
+{
+	if (CachedContainer && CachedInventoryComponent)
 	{
-		return;
+		CachedInventoryComponent->DepositToContainer(*CachedContainer);
 	}
-
-	CachedContainer->AddItemToContainer(ItemCopy);
 }
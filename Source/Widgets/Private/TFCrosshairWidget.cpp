@@ -1,8 +1,10 @@
 // Copyright TF Project. All Rights Reserved.
 
 #include "TFCrosshairWidget.h"
+#include "TFStats.h"
 #include "TFPlayerCharacter.h"
 #include "TFInteractionComponent.h"
+#include "TFViewQuerySubsystem.h"
 #include "TFPlayerController.h"
 #include "Components/Image.h"
 #include "Components/CanvasPanel.h"
@@ -63,6 +65,8 @@ void UTFCrosshairWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTi
 {
 	Super::NativeTick(MyGeometry, InDeltaTime);
 
+	TF_SCOPE_CYCLE_COUNTER(CrosshairTick);
+
 	// Update visibility
 	UpdateVisibility();
 
@@ -118,55 +122,41 @@ void UTFCrosshairWidget::InitializePlayerCharacter()
 
 bool UTFCrosshairWidget::PerformTrace(FHitResult& OutHitResult)
 {
-	UWorld* World = GetWorld();
-	if (!World)
+	if (!CachedPlayerCharacter.IsValid())
 	{
 		return false;
 	}
 
-	FVector TraceStart, TraceEnd;
-	if (!GetTracePoints(TraceStart, TraceEnd))
+	// Nothing interactable nearby: the crosshair rests at the view center without tracing
+	UTFInteractionComponent* InteractionComp = CachedPlayerCharacter->GetInteractionComponent();
+	if (InteractionComp && !InteractionComp->HasInteractable() && !InteractionComp->HasInteractableInRange())
 	{
+		if (APlayerController* PC = GetOwningPlayer())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			CurrentTraceEnd = ViewLocation + ViewRotation.Vector() * TraceDistance;
+		}
 		return false;
 	}
 
-	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TFCrosshairTrace), bTraceComplex);
-
-	if (CachedPlayerCharacter.IsValid())
-	{
-		QueryParams.AddIgnoredActor(CachedPlayerCharacter.Get());
-	}
-
-	return World->LineTraceSingleByChannel(
-		OutHitResult,
-		TraceStart,
-		TraceEnd,
-		TraceChannel,
-		QueryParams
-	);
-}
-
-bool UTFCrosshairWidget::GetTracePoints(FVector& TraceStart, FVector& TraceEnd) const
-{
-	if (!CachedPlayerCharacter.IsValid())
+	// Shared with the interaction component: at most one view trace per frame
+	UTFViewQuerySubsystem* ViewQuery = UTFViewQuerySubsystem::Get(GetOwningPlayer());
+	const FTFViewQueryResult* ViewResult = ViewQuery ? ViewQuery->QueryView(TraceChannel, bTraceComplex, TraceDistance) : nullptr;
+	if (!ViewResult)
 	{
 		return false;
 	}
 
-	APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
-	if (!PC)
+	CurrentTraceEnd = ViewResult->ViewLocation + ViewResult->ViewRotation.Vector() * TraceDistance;
+
+	if (!ViewResult->HasHitWithin(TraceDistance))
 	{
 		return false;
 	}
 
-	// Get camera location and rotation from player controller
-	FVector CameraLocation;
-	FRotator CameraRotation;
-	PC->GetPlayerViewPoint(CameraLocation, CameraRotation);
-
-	TraceStart = CameraLocation;
-	TraceEnd = TraceStart + (CameraRotation.Vector() * TraceDistance);
-
+	OutHitResult = ViewResult->Hit;
 	return true;
 }
 
@@ -209,28 +199,24 @@ void UTFCrosshairWidget::UpdateCrosshairPositionNoHit(float DeltaTime)
 	}
 
 	// When no hit, project the end point of the trace to screen
-	FVector TraceStart, TraceEnd;
-	if (GetTracePoints(TraceStart, TraceEnd))
+	FVector2D ScreenPosition;
+	if (PC->ProjectWorldLocationToScreen(CurrentTraceEnd, ScreenPosition, true))
 	{
-		FVector2D ScreenPosition;
-		if (PC->ProjectWorldLocationToScreen(TraceEnd, ScreenPosition, true))
+		// Convert to offset from screen center
+		if (GEngine && GEngine->GameViewport)
 		{
-			// Convert to offset from screen center
-			if (GEngine && GEngine->GameViewport)
+			FVector2D ViewportSize;
+			GEngine->GameViewport->GetViewportSize(ViewportSize);
+			FVector2D ScreenCenter = ViewportSize * 0.5f;
+
+			// Calculate offset from center, then convert to Slate units
+			FVector2D Offset = ScreenPosition - ScreenCenter;
+			const float ViewportScale = GEngine->GameViewport->GetDPIScale();
+			if (ViewportScale > 0.0f)
 			{
-				FVector2D ViewportSize;
-				GEngine->GameViewport->GetViewportSize(ViewportSize);
-				FVector2D ScreenCenter = ViewportSize * 0.5f;
-
-				// Calculate offset from center, then convert to Slate units
-				FVector2D Offset = ScreenPosition - ScreenCenter;
-				const float ViewportScale = GEngine->GameViewport->GetDPIScale();
-				if (ViewportScale > 0.0f)
-				{
-					Offset /= ViewportScale;
-				}
-				TargetScreenPosition = Offset;
+				Offset /= ViewportScale;
 			}
+			TargetScreenPosition = Offset;
 		}
 	}
 }
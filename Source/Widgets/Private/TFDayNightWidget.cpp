@@ -19,7 +19,7 @@ void UTFDayNightWidget::NativeDestruct()
 	// Unbind from day/night cycle to prevent crashes
 	if (CachedDayNightCycle)
 	{
-		CachedDayNightCycle->OnTimeChanged.RemoveAll(this);
+		CachedDayNightCycle->Unschedule(TimeDisplayHandle);
 		CachedDayNightCycle->OnDayChanged.RemoveAll(this);
 		CachedDayNightCycle->OnDayNightStateChanged.RemoveAll(this);
 		CachedDayNightCycle = nullptr;
@@ -36,7 +36,7 @@ void UTFDayNightWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTim
 	{
 		InitializeDayNightCycle();
 	}
-	// Time display is updated via OnTimeChanged delegate, no per-frame update needed
+	// Time display is updated from the day/night timeline, no per-frame update needed
 }
 
 void UTFDayNightWidget::InitializeDayNightCycle()
@@ -55,7 +55,7 @@ void UTFDayNightWidget::InitializeDayNightCycle()
 
 	if (CachedDayNightCycle)
 	{
-		CachedDayNightCycle->OnTimeChanged.AddUObject(this, &UTFDayNightWidget::OnTimeChanged);
+		TimeDisplayHandle = CachedDayNightCycle->ScheduleEvery(GetTimeDisplayIntervalMinutes(), FOnScheduledTime::CreateUObject(this, &UTFDayNightWidget::OnTimeChanged));
 		CachedDayNightCycle->OnDayChanged.AddUObject(this, &UTFDayNightWidget::OnDayChanged);
 		CachedDayNightCycle->OnDayNightStateChanged.AddUObject(this, &UTFDayNightWidget::OnDayNightStateChanged);
 
@@ -67,6 +67,12 @@ void UTFDayNightWidget::InitializeDayNightCycle()
 	}
 }
 
+float UTFDayNightWidget::GetTimeDisplayIntervalMinutes() const
+{
+	// One game second when seconds are shown, otherwise one game minute
+	return TimeWithSecondsText ? 1.0f / 60.0f : 1.0f;
+}
+
 void UTFDayNightWidget::UpdateTimeDisplay(float CurrentTimeHours)
 {
 	if (!TimeText || !CachedDayNightCycle)
@@ -127,7 +133,7 @@ void UTFDayNightWidget::SetDayNightCycle(ATFDayNightCycle* NewDayNightCycle)
 {
 	if (CachedDayNightCycle)
 	{
-		CachedDayNightCycle->OnTimeChanged.RemoveAll(this);
+		CachedDayNightCycle->Unschedule(TimeDisplayHandle);
 		CachedDayNightCycle->OnDayChanged.RemoveAll(this);
 		CachedDayNightCycle->OnDayNightStateChanged.RemoveAll(this);
 	}
@@ -136,7 +142,7 @@ void UTFDayNightWidget::SetDayNightCycle(ATFDayNightCycle* NewDayNightCycle)
 
 	if (CachedDayNightCycle)
 	{
-		CachedDayNightCycle->OnTimeChanged.AddUObject(this, &UTFDayNightWidget::OnTimeChanged);
+		TimeDisplayHandle = CachedDayNightCycle->ScheduleEvery(GetTimeDisplayIntervalMinutes(), FOnScheduledTime::CreateUObject(this, &UTFDayNightWidget::OnTimeChanged));
 		CachedDayNightCycle->OnDayChanged.AddUObject(this, &UTFDayNightWidget::OnDayChanged);
 		CachedDayNightCycle->OnDayNightStateChanged.AddUObject(this, &UTFDayNightWidget::OnDayNightStateChanged);
 
@@ -31,7 +31,37 @@ void UTFInventoryItemEntryWidget::NativeOnListItemObjectSet(UObject* ListItemObj
 {
 	IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject);
 
-	CachedViewData = Cast<UTFInventoryItemViewData>(ListItemObject);
+	SetViewData(Cast<UTFInventoryItemViewData>(ListItemObject));
+}
+
+void UTFInventoryItemEntryWidget::NativeOnEntryReleased()
+{
+	IUserObjectListEntry::NativeOnEntryReleased();
+
+	SetViewData(nullptr);
+}
+
+void UTFInventoryItemEntryWidget::SetViewData(UTFInventoryItemViewData* ViewData)
+{
+	if (CachedViewData)
+	{
+		CachedViewData->OnChanged.RemoveAll(this);
+	}
+
+	CachedViewData = ViewData;
+
+	if (!CachedViewData)
+	{
+		return;
+	}
+
+	// The list keeps this entry when a recycled object is pointed at another item
+	CachedViewData->OnChanged.AddUObject(this, &UTFInventoryItemEntryWidget::RefreshFromViewData);
+	RefreshFromViewData();
+}
+
+void UTFInventoryItemEntryWidget::RefreshFromViewData()
+{
 	if (!CachedViewData)
 	{
 		return;
@@ -39,8 +69,8 @@ void UTFInventoryItemEntryWidget::NativeOnListItemObjectSet(UObject* ListItemObj
 
 	if (ItemNameText)
 	{
-		const FItemData& Data = CachedViewData->ItemData;
-		const FString DisplayText = FString::Printf(TEXT("%s  (%.1f kg)"), *Data.ItemName.ToString(), Data.Weight);
+		const FItemDefinition& Definition = CachedViewData->ItemData.GetDefinition();
+		const FString DisplayText = FString::Printf(TEXT("%s  (%.1f kg)"), *Definition.ItemName.ToString(), Definition.Weight);
 		ItemNameText->SetText(FText::FromString(DisplayText));
 	}
 
@@ -84,7 +114,7 @@ void UTFInventoryItemEntryWidget::UpdateConsumeButton()
 		return;
 	}
 
-	const EItemType Type = CachedViewData->ItemData.ItemType;
+	const EItemType Type = CachedViewData->ItemData.GetDefinition().ItemType;
 
 	if (Type == EItemType::Food)
 	{
@@ -1,3 +1,10 @@
 // Copyright TF Project. All Rights Reserved.
 
 #include "TFInventoryItemViewData.h"
+
+void UTFInventoryItemViewData::SetItem(const FItemData& InItemData, FInventoryItemHandle InHandle)
+{
+	ItemData = InItemData;
+	Handle = InHandle;
+	OnChanged.Broadcast();
+}
@@ -2,6 +2,7 @@
 
 #include "TFInventoryWidget.h"
 #include "TFInventoryItemViewData.h"
+#include "TFTypes.h"
 
 #include "TFInventoryComponent.h"
 #include "TFPlayerCharacter.h"
@@ -28,6 +29,7 @@ void UTFInventoryWidget::NativeDestruct()
 	{
 		CachedInventoryComponent->OnItemAdded.RemoveAll(this);
 		CachedInventoryComponent->OnItemRemoved.RemoveAll(this);
+		CachedInventoryComponent->OnItemsChanged.RemoveAll(this);
 		CachedInventoryComponent->OnInventoryChanged.RemoveAll(this);
 		CachedInventoryComponent = nullptr;
 	}
@@ -62,6 +64,7 @@ void UTFInventoryWidget::InitializeInventoryComponent()
 
 	CachedInventoryComponent->OnItemAdded.AddUObject(this, &UTFInventoryWidget::OnItemAdded);
 	CachedInventoryComponent->OnItemRemoved.AddUObject(this, &UTFInventoryWidget::OnItemRemoved);
+	CachedInventoryComponent->OnItemsChanged.AddUObject(this, &UTFInventoryWidget::OnItemsChanged);
 	CachedInventoryComponent->OnInventoryChanged.AddUObject(this, &UTFInventoryWidget::OnInventoryChanged);
 
 	if (ATFPlayerController* PC = Cast<ATFPlayerController>(UGameplayStatics::GetPlayerController(GetWorld(), 0)))
@@ -71,32 +74,87 @@ void UTFInventoryWidget::InitializeInventoryComponent()
 
 }
 
-void UTFInventoryWidget::PopulateListView()
+UTFInventoryItemViewData* UTFInventoryWidget::AcquireViewData(const FItemData& Item, FInventoryItemHandle Handle)
 {
-	if (!ItemListView)
+	UTFInventoryItemViewData* ViewData = nullptr;
+
+	if (ViewDataPool.Num() > 0)
 	{
-		return;
+		ViewData = ViewDataPool.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		ViewData = NewObject<UTFInventoryItemViewData>(this);
+		++NumViewDataAllocated;
 	}
 
-	ItemListView->ClearListItems();
-	ListItems.Empty();
+	ViewData->OwnerWidget = this;
+	ViewData->SetItem(Item, Handle);
 
-	if (!CachedInventoryComponent)
+	return ViewData;
+}
+
+void UTFInventoryWidget::ReleaseViewData(UTFInventoryItemViewData* ViewData)
+{
+	if (ViewData)
+	{
+		ViewData->ItemData = FItemData();
+		ViewData->Handle = FInventoryItemHandle();
+		ViewDataPool.Add(ViewData);
+	}
+}
+
+void UTFInventoryWidget::ReleaseAllListItems()
+{
+	for (UTFInventoryItemViewData* ViewData : ListItems)
+	{
+		ReleaseViewData(ViewData);
+	}
+	ListItems.Reset();
+
+	if (ItemListView)
+	{
+		ItemListView->ClearListItems();
+	}
+}
+
+void UTFInventoryWidget::PopulateListView()
+{
+	if (!ItemListView)
 	{
 		return;
 	}
 
-	const TArray<FItemData>& Items = CachedInventoryComponent->GetItems();
+	// Rows whose item is gone; surviving rows keep their object, so the list keeps their entries
+	for (int32 i = ListItems.Num() - 1; i >= 0; --i)
+	{
+		UTFInventoryItemViewData* ViewData = ListItems[i];
+		if (CachedInventoryComponent && ViewData && CachedInventoryComponent->IsValidHandle(ViewData->Handle))
+		{
+			continue;
+		}
+
+		ItemListView->RemoveItem(ViewData);
+		ListItems.RemoveAt(i);
+		ReleaseViewData(ViewData);
+	}
 
-	for (const FItemData& Item : Items)
+	if (CachedInventoryComponent)
 	{
-		UTFInventoryItemViewData* ViewData = NewObject<UTFInventoryItemViewData>(this);
-		ViewData->ItemData = Item;
-		ViewData->OwnerWidget = this;
+		TArray<FInventoryItemHandle> Handles;
+		CachedInventoryComponent->GetHandlesInAddOrder(Handles);
 
-		ListItems.Add(ViewData);
-		ItemListView->AddItem(ViewData);
+		// Items added since the last sync are newer than every surviving row, so they follow them in add order
+		for (int32 Index = ListItems.Num(); Index < Handles.Num(); ++Index)
+		{
+			UTFInventoryItemViewData* ViewData = AcquireViewData(*CachedInventoryComponent->GetItemByHandle(Handles[Index]), Handles[Index]);
+			ListItems.Add(ViewData);
+			ItemListView->AddItem(ViewData);
+		}
 	}
+
+	UE_LOG(LogTFItem, Verbose, TEXT("UTFInventoryWidget: %d rows, %d view data allocated, %d pooled"),
+		ListItems.Num(), NumViewDataAllocated, ViewDataPool.Num());
 }
 
 void UTFInventoryWidget::UpdateWeightDisplay(float CurrentWeight, float MaxWeight)
@@ -160,32 +218,20 @@ void UTFInventoryWidget::UpdateWeightColor(float WeightPercent)
 
 void UTFInventoryWidget::OnItemAdded(const FItemData& Item)
 {
-	if (ItemListView)
-	{
-		UTFInventoryItemViewData* ViewData = NewObject<UTFInventoryItemViewData>(this);
-		ViewData->ItemData = Item;
-		ViewData->OwnerWidget = this;
-
-		ListItems.Add(ViewData);
-		ItemListView->AddItem(ViewData);
-	}
+	PopulateListView();
 	UpdateSlotDisplay();
 }
 
 void UTFInventoryWidget::OnItemRemoved(FName ItemID)
 {
-	if (ItemListView)
-	{
-		for (int32 i = ListItems.Num() - 1; i >= 0; --i)
-		{
-			if (ListItems[i] && ListItems[i]->ItemData.ItemID == ItemID)
-			{
-				ItemListView->RemoveItem(ListItems[i]);
-				ListItems.RemoveAt(i);
-				break;
-			}
-		}
-	}
+	PopulateListView();
+	UpdateSlotDisplay();
+}
+
+void UTFInventoryWidget::OnItemsChanged(const FTFItemDelta& Delta)
+{
+	// One diff for the whole batch
+	PopulateListView();
 	UpdateSlotDisplay();
 }
 
@@ -217,15 +263,23 @@ void UTFInventoryWidget::SetInventoryComponent(UTFInventoryComponent* NewInvento
 	{
 		CachedInventoryComponent->OnItemAdded.RemoveAll(this);
 		CachedInventoryComponent->OnItemRemoved.RemoveAll(this);
+		CachedInventoryComponent->OnItemsChanged.RemoveAll(this);
 		CachedInventoryComponent->OnInventoryChanged.RemoveAll(this);
 	}
 
+	// Handles from the previous inventory mean nothing to the new one
+	if (CachedInventoryComponent != NewInventoryComponent)
+	{
+		ReleaseAllListItems();
+	}
+
 	CachedInventoryComponent = NewInventoryComponent;
 
 	if (CachedInventoryComponent)
 	{
 		CachedInventoryComponent->OnItemAdded.AddUObject(this, &UTFInventoryWidget::OnItemAdded);
 		CachedInventoryComponent->OnItemRemoved.AddUObject(this, &UTFInventoryWidget::OnItemRemoved);
+		CachedInventoryComponent->OnItemsChanged.AddUObject(this, &UTFInventoryWidget::OnItemsChanged);
 		CachedInventoryComponent->OnInventoryChanged.AddUObject(this, &UTFInventoryWidget::OnInventoryChanged);
 	}
 
@@ -260,7 +314,7 @@ void UTFInventoryWidget::ExamineItem(FName ItemID)
 
 	if (const FItemData* Item = CachedInventoryComponent->GetItem(ItemID))
 	{
-		DescriptionText->SetText(Item->ItemDescription);
+		DescriptionText->SetText(Item->GetDefinition().ItemDescription);
 		CurrentExaminedItemID = ItemID;
 	}
 }
@@ -305,7 +359,9 @@ void UTFInventoryWidget::ConsumeItem(FName ItemID)
 		return;
 	}
 
-	if (Item->ItemType != EItemType::Food && Item->ItemType != EItemType::Beverage)
+	const FItemDefinition& Definition = Item->GetDefinition();
+
+	if (Definition.ItemType != EItemType::Food && Definition.ItemType != EItemType::Beverage)
 	{
 		return;
 	}
@@ -328,14 +384,14 @@ void UTFInventoryWidget::ConsumeItem(FName ItemID)
 		return;
 	}
 
-	if (Item->HungerRestore > 0.0f)
+	if (Definition.HungerRestore > 0.0f)
 	{
-		Stats->RestoreHunger(Item->HungerRestore);
+		Stats->RestoreHunger(Definition.HungerRestore);
 	}
 
-	if (Item->ThirstRestore > 0.0f)
+	if (Definition.ThirstRestore > 0.0f)
 	{
-		Stats->RestoreThirst(Item->ThirstRestore);
+		Stats->RestoreThirst(Definition.ThirstRestore);
 	}
 
 	// Remove item from inventory after consumption
@@ -58,6 +58,17 @@ void UTFStatsWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 		return;
 	}
 
+	if (CachedStatsComponent->IsAnalyticDecay())
+	{
+		StatsPollTimer += InDeltaTime;
+		if (StatsPollTimer >= StatsPollInterval)
+		{
+			StatsPollTimer = 0.0f;
+			OnHungerChanged(CachedStatsComponent->GetCurrentHunger(), CachedStatsComponent->GetMaxHunger());
+			OnThirstChanged(CachedStatsComponent->GetCurrentThirst(), CachedStatsComponent->GetMaxThirst());
+		}
+	}
+
 	// Update pulse effects only (colors are updated in delegate callbacks)
 	if (bEnablePulseEffect)
 	{
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "TFPickupableInterface.h"
+#include "TFInventoryComponent.h"
 #include "TFContainerItemViewData.generated.h"
 
 class UTFContainerWidget;
@@ -29,6 +30,9 @@ public:
 	UPROPERTY()
 	EContainerItemSource Source;
 
+	/** Inventory item this row shows; unset for container rows */
+	FInventoryItemHandle Handle;
+
 	UPROPERTY()
 	TWeakObjectPtr<UTFContainerWidget> OwnerWidget;
 };
@@ -6,13 +6,14 @@
 #include "Blueprint/UserWidget.h"
 #include "TFPickupableInterface.h"
 #include "TFContainerInterface.h"
+#include "TFContainerItemViewData.h"
 #include "TFContainerWidget.generated.h"
 
 class UTFInventoryComponent;
-class UTFContainerItemViewData;
 class UListView;
 class UTextBlock;
 class UButton;
+struct FTFItemDelta;
 
 UCLASS()
 class WIDGETS_API UTFContainerWidget : public UUserWidget
@@ -41,6 +42,12 @@ protected:
 	UPROPERTY(meta = (BindWidgetOptional))
 	UButton* CloseButton;
 
+	UPROPERTY(meta = (BindWidgetOptional))
+	UButton* TakeAllButton;
+
+	UPROPERTY(meta = (BindWidgetOptional))
+	UButton* DepositAllButton;
+
 #pragma endregion Widget Bindings
 
 private:
@@ -56,6 +63,22 @@ private:
 	UPROPERTY()
 	TArray<UTFContainerItemViewData*> InventoryListItems;
 
+	/** Released view data, reused before allocating new objects */
+	UPROPERTY()
+	TArray<UTFContainerItemViewData*> ViewDataPool;
+
+	UTFContainerItemViewData* AcquireViewData(const FItemData& Item, EContainerItemSource Source, FInventoryItemHandle Handle = FInventoryItemHandle());
+	void ReleaseViewData(UTFContainerItemViewData* ViewData);
+
+	/** Diff ListItems against Items: matching entries are kept, only the difference is added or removed */
+	void SyncListItems(UListView* ListView, TArray<UTFContainerItemViewData*>& ListItems, const TArray<FItemData>& Items, EContainerItemSource Source);
+
+	/** Appends inventory rows for the Count newest items */
+	void AddNewestInventoryRows(int32 Count);
+
+	/** Drops inventory rows whose item is gone; with an ItemID, stops after that item's row */
+	void RemoveStaleInventoryRows(FName ItemID = NAME_None);
+
 protected:
 
 	virtual void NativeConstruct() override;
@@ -70,14 +93,25 @@ protected:
 	void OnContainerChanged();
 	void OnInventoryItemAdded(const FItemData& Item);
 	void OnInventoryItemRemoved(FName ItemID);
+	void OnInventoryItemsChanged(const FTFItemDelta& Delta);
 
 	UFUNCTION()
 	void OnCloseClicked();
 
+	UFUNCTION()
+	void OnTakeAllClicked();
+
+	UFUNCTION()
+	void OnDepositAllClicked();
+
 public:
 
 	void SetContainerSource(ITFContainerInterface* Container);
 	void RefreshDisplay();
 	void TakeItem(FName ItemID);
 	void DepositItem(FName ItemID);
+
+	/** Moves everything in one transaction; nothing moves if it does not all fit */
+	void TakeAllItems();
+	void DepositAllItems();
 };
@@ -123,6 +123,9 @@ private:
 	/** Did the trace hit anything */
 	bool bHasHit = false;
 
+	/** End point of the current view trace, used when nothing is hit */
+	FVector CurrentTraceEnd = FVector::ZeroVector;
+
 protected:
 
 	virtual void NativeConstruct() override;
@@ -132,12 +135,9 @@ protected:
 	/** Find and cache player character */
 	void InitializePlayerCharacter();
 
-	/** Perform line trace from camera */
+	/** Fetch this frame's view trace from the shared view query */
 	bool PerformTrace(FHitResult& OutHitResult);
 
-	/** Get trace start and end points from player camera */
-	bool GetTracePoints(FVector& TraceStart, FVector& TraceEnd) const;
-
 	/** Update crosshair position based on hit result */
 	void UpdateCrosshairPosition(const FHitResult& HitResult, float DeltaTime);
 
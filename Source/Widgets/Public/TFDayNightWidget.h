@@ -78,12 +78,15 @@ private:
 
 	bool bLastWasDay = true;
 
+	FDelegateHandle TimeDisplayHandle;
+
 protected:
 
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
 	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 	void InitializeDayNightCycle();
+	float GetTimeDisplayIntervalMinutes() const;
 	void UpdateTimeDisplay(float CurrentTimeHours);
 	void UpdateDayDisplay(int32 CurrentDay);
 	void UpdateDayNightIcon(bool bIsDay);
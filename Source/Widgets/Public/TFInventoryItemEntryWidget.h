@@ -40,6 +40,7 @@ protected:
 
 	virtual void NativeConstruct() override;
 	virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+	virtual void NativeOnEntryReleased() override;
 
 private:
 
@@ -55,5 +56,7 @@ private:
 	UFUNCTION()
 	void OnConsumeClicked();
 
+	void SetViewData(UTFInventoryItemViewData* ViewData);
+	void RefreshFromViewData();
 	void UpdateConsumeButton();
 };
@@ -5,13 +5,16 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "TFPickupableInterface.h"
+#include "TFInventoryComponent.h"
 #include "TFInventoryItemViewData.generated.h"
 
 class UTFInventoryWidget;
 
+DECLARE_MULTICAST_DELEGATE(FOnInventoryItemViewDataChanged);
+
 /**
  * Data object for a single inventory ListView row.
- * Each instance wraps one FItemData and a back-pointer to the owning widget.
+ * Each instance tracks one inventory item by handle and keeps a back-pointer to the owning widget.
  */
 UCLASS()
 class WIDGETS_API UTFInventoryItemViewData : public UObject
@@ -20,9 +23,17 @@ class WIDGETS_API UTFInventoryItemViewData : public UObject
 
 public:
 
+	/** Points this row at an item; a pooled object may still be shown by an entry, which refreshes through OnChanged */
+	void SetItem(const FItemData& InItemData, FInventoryItemHandle InHandle);
+
 	UPROPERTY()
 	FItemData ItemData;
 
+	/** Inventory item this row shows */
+	FInventoryItemHandle Handle;
+
 	UPROPERTY()
 	TWeakObjectPtr<UTFInventoryWidget> OwnerWidget;
+
+	FOnInventoryItemViewDataChanged OnChanged;
 };
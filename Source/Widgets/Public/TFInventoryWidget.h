@@ -12,6 +12,8 @@ class UTFInventoryItemViewData;
 class UListView;
 class UTextBlock;
 class UProgressBar;
+struct FTFItemDelta;
+struct FInventoryItemHandle;
 
 
 UCLASS()
@@ -67,6 +69,17 @@ private:
 	UPROPERTY()
 	TArray<UTFInventoryItemViewData*> ListItems;
 
+	/** Released view data, recycled across refreshes and inventory toggles */
+	UPROPERTY()
+	TArray<UTFInventoryItemViewData*> ViewDataPool;
+
+	/** View data objects ever created by this widget; flat in steady state */
+	int32 NumViewDataAllocated = 0;
+
+	UTFInventoryItemViewData* AcquireViewData(const FItemData& Item, FInventoryItemHandle Handle);
+	void ReleaseViewData(UTFInventoryItemViewData* ViewData);
+	void ReleaseAllListItems();
+
 	FName CurrentExaminedItemID = NAME_None;
 
 protected:
@@ -75,6 +88,7 @@ protected:
 	virtual void NativeDestruct() override;
 
 	void InitializeInventoryComponent();
+	/** Diffs the rows against the inventory by handle; rows for items still held keep their view data */
 	void PopulateListView();
 	void UpdateWeightDisplay(float CurrentWeight, float MaxWeight);
 	void UpdateSlotDisplay();
@@ -82,6 +96,7 @@ protected:
 
 	void OnItemAdded(const FItemData& Item);
 	void OnItemRemoved(FName ItemID);
+	void OnItemsChanged(const FTFItemDelta& Delta);
 	void OnInventoryChanged(float CurrentWeight, float MaxWeight);
 
 	UFUNCTION()
@@ -94,4 +109,7 @@ public:
 	void ExamineItem(FName ItemID);
 	void DiscardItem(FName ItemID);
 	void ConsumeItem(FName ItemID);
+
+	int32 GetNumViewDataAllocated() const { return NumViewDataAllocated; }
+	int32 GetNumPooledViewData() const { return ViewDataPool.Num(); }
 };
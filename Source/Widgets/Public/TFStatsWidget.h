@@ -112,6 +112,10 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Stats|Effects", meta = (ClampMin = "0.0", ClampMax = "1.0"))
 	float PulseBaseOpacity = 0.7f;
 
+	/** Seconds between bar refreshes when the stats subsystem evaluates decay on query */
+	UPROPERTY(EditAnywhere, Category = "Stats|Effects", meta = (ClampMin = "0.05", ClampMax = "5.0"))
+	float StatsPollInterval = 0.25f;
+
 #pragma endregion Effects Settings
 
 private:
@@ -129,6 +133,9 @@ private:
 	/** Accumulator for retrying stats component lookup when the pawn is not yet possessed */
 	float StatsComponentRetryTimer = 0.0f;
 
+	/** Accumulator for polling decayed values; analytic decay only broadcasts at thresholds */
+	float StatsPollTimer = 0.0f;
+
 protected:
 
 	virtual void NativeConstruct() override;
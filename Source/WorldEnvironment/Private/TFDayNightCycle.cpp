@@ -1,4 +1,5 @@
 #include "TFDayNightCycle.h"
+#include "TFStats.h"
 #include "Engine/DirectionalLight.h"
 #include "Components/LightComponent.h"
 
@@ -33,6 +34,15 @@ void ATFDayNightCycle::BeginPlay()
     CurrentTimeHours = StartingTimeHours;
     CurrentDay = StartingDay;
     bWasDay = IsDay();
+    LastDayPhase = GetDayPhase();
+
+    // Listeners may have scheduled against the pre-play clock
+    RebuildTimeline();
+
+    TimeChangedHandle = ScheduleEvery(TimeChangedIntervalMinutes, FOnScheduledTime::CreateWeakLambda(this, [this](float)
+    {
+        BroadcastTimeChanged();
+    }));
 
     // Broadcast initial state
     BroadcastTimeChanged();
@@ -55,6 +65,8 @@ void ATFDayNightCycle::Tick(float DeltaTime)
 
 void ATFDayNightCycle::UpdateTime(float DeltaTime)
 {
+    TF_SCOPE_CYCLE_COUNTER(DayNightUpdate);
+
     // Calculate how many game hours pass per real second
     const float GameHoursPerRealSecond = 1.0f / RealSecondsPerGameHour;
 
@@ -69,6 +81,16 @@ void ATFDayNightCycle::UpdateTime(float DeltaTime)
         OnDayChanged.Broadcast(CurrentDay);
     }
 
+    CheckDayStateChanges();
+
+    // Time listeners are notified from the timeline, not every frame
+    DispatchTimeline();
+
+    TickSunLight(DeltaTime);
+}
+
+void ATFDayNightCycle::CheckDayStateChanges()
+{
     // Check for day/night state change
     const bool bIsCurrentlyDay = IsDay();
     if (bIsCurrentlyDay != bWasDay)
@@ -77,13 +99,146 @@ void ATFDayNightCycle::UpdateTime(float DeltaTime)
         OnDayNightStateChanged.Broadcast(bIsCurrentlyDay);
     }
 
-    // Broadcast time update
-    BroadcastTimeChanged();
+    const int32 DayPhase = GetDayPhase();
+    if (DayPhase != LastDayPhase)
+    {
+        LastDayPhase = DayPhase;
+        OnDayPhaseChanged.Broadcast(DayPhase);
+    }
+}
 
-    // Update sun light
+void ATFDayNightCycle::HandleTimeJump()
+{
+    CheckDayStateChanges();
+    RebuildTimeline();
+
+    // Periodic listeners, OnTimeChanged included, see the new time at once
+    DispatchTimeJump();
     UpdateSunLight();
 }
 
+#pragma region Scheduler
+
+FDelegateHandle ATFDayNightCycle::ScheduleEvery(float IntervalGameMinutes, FOnScheduledTime Callback)
+{
+    const double Period = FMath::Max(0.01f, IntervalGameMinutes) / 60.0;
+    return AddScheduledEvent(0.0, Period, MoveTemp(Callback), true);
+}
+
+FDelegateHandle ATFDayNightCycle::ScheduleAtHour(float Hour, FOnScheduledTime Callback)
+{
+    return AddScheduledEvent(FMath::Clamp(Hour, 0.0f, 24.0f), 24.0, MoveTemp(Callback), false);
+}
+
+void ATFDayNightCycle::Unschedule(FDelegateHandle Handle)
+{
+    if (!Handle.IsValid())
+    {
+        return;
+    }
+
+    if (Handle == DispatchingHandle)
+    {
+        bDispatchingUnscheduled = true;
+        return;
+    }
+
+    if (Timeline.RemoveAll([Handle](const FScheduledEvent& Event) { return Event.Handle == Handle; }) > 0)
+    {
+        Timeline.Heapify(FScheduledEventOrder());
+    }
+}
+
+FDelegateHandle ATFDayNightCycle::AddScheduledEvent(double Offset, double Period, FOnScheduledTime&& Callback, bool bFireOnTimeJump)
+{
+    const double Now = GetAbsoluteTimeHours();
+
+    FScheduledEvent Event;
+    Event.Offset = Offset;
+    Event.Period = Period;
+    Event.DueTime = Offset + (FMath::FloorToDouble((Now - Offset) / Period) + 1.0) * Period;
+    Event.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+    Event.Callback = MoveTemp(Callback);
+    Event.bFireOnTimeJump = bFireOnTimeJump;
+
+    const FDelegateHandle Handle = Event.Handle;
+    Timeline.HeapPush(MoveTemp(Event), FScheduledEventOrder());
+    return Handle;
+}
+
+void ATFDayNightCycle::DispatchTimeline()
+{
+    const double Now = GetAbsoluteTimeHours();
+
+    while (Timeline.Num() > 0 && Timeline.HeapTop().DueTime <= Now)
+    {
+        FScheduledEvent Event;
+        Timeline.HeapPop(Event, FScheduledEventOrder(), EAllowShrinking::No);
+
+        // Fire once even if several periods elapsed this frame
+        DispatchingHandle = Event.Handle;
+        bDispatchingUnscheduled = false;
+        Event.Callback.ExecuteIfBound(CurrentTimeHours);
+        DispatchingHandle.Reset();
+
+        if (bDispatchingUnscheduled || !Event.Callback.IsBound())
+        {
+            continue;
+        }
+
+        Event.DueTime = Event.Offset + (FMath::FloorToDouble((Now - Event.Offset) / Event.Period) + 1.0) * Event.Period;
+        Timeline.HeapPush(MoveTemp(Event), FScheduledEventOrder());
+    }
+}
+
+void ATFDayNightCycle::DispatchTimeJump()
+{
+    TArray<FDelegateHandle, TInlineAllocator<8>> Handles;
+    for (const FScheduledEvent& Event : Timeline)
+    {
+        if (Event.bFireOnTimeJump)
+        {
+            Handles.Add(Event.Handle);
+        }
+    }
+
+    for (const FDelegateHandle& Handle : Handles)
+    {
+        const FScheduledEvent* Event = Timeline.FindByPredicate([&Handle](const FScheduledEvent& Candidate) { return Candidate.Handle == Handle; });
+        if (!Event)
+        {
+            continue;
+        }
+
+        // Copy: a callback that schedules another event may reallocate the timeline
+        const FOnScheduledTime Callback = Event->Callback;
+
+        DispatchingHandle = Handle;
+        bDispatchingUnscheduled = false;
+        Callback.ExecuteIfBound(CurrentTimeHours);
+        DispatchingHandle.Reset();
+
+        if (bDispatchingUnscheduled)
+        {
+            Unschedule(Handle);
+        }
+    }
+}
+
+void ATFDayNightCycle::RebuildTimeline()
+{
+    const double Now = GetAbsoluteTimeHours();
+
+    for (FScheduledEvent& Event : Timeline)
+    {
+        Event.DueTime = Event.Offset + (FMath::FloorToDouble((Now - Event.Offset) / Event.Period) + 1.0) * Event.Period;
+    }
+
+    Timeline.Heapify(FScheduledEventOrder());
+}
+
+#pragma endregion
+
 void ATFDayNightCycle::BroadcastTimeChanged()
 {
     OnTimeChanged.Broadcast(CurrentTimeHours);
@@ -150,15 +305,7 @@ void ATFDayNightCycle::SetTime(float NewTimeHours)
 {
     CurrentTimeHours = FMath::Clamp(NewTimeHours, 0.0f, 23.999f);
 
-    // Check for day/night state change
-    const bool bIsCurrentlyDay = IsDay();
-    if (bIsCurrentlyDay != bWasDay)
-    {
-        bWasDay = bIsCurrentlyDay;
-        OnDayNightStateChanged.Broadcast(bIsCurrentlyDay);
-    }
-
-    BroadcastTimeChanged();
+    HandleTimeJump();
 }
 
 void ATFDayNightCycle::SetDay(int32 NewDay)
@@ -167,6 +314,7 @@ void ATFDayNightCycle::SetDay(int32 NewDay)
     {
         CurrentDay = NewDay;
         OnDayChanged.Broadcast(CurrentDay);
+        RebuildTimeline();
     }
 }
 
@@ -195,15 +343,7 @@ void ATFDayNightCycle::AddHours(float HoursToAdd)
 
     CurrentTimeHours = NewTime;
 
-    // Check for day/night state change
-    const bool bIsCurrentlyDay = IsDay();
-    if (bIsCurrentlyDay != bWasDay)
-    {
-        bWasDay = bIsCurrentlyDay;
-        OnDayNightStateChanged.Broadcast(bIsCurrentlyDay);
-    }
-
-    BroadcastTimeChanged();
+    HandleTimeJump();
 }
 
 void ATFDayNightCycle::SkipToSunrise()
@@ -306,6 +446,33 @@ void ATFDayNightCycle::RefreshSunLight()
     UpdateSunLight();
 }
 
+void ATFDayNightCycle::TickSunLight(float DeltaTime)
+{
+    if (!SunLight || !bControlSunLight)
+    {
+        return;
+    }
+
+    SunUpdateAccumulator += DeltaTime;
+    if (SunUpdateAccumulator < SunUpdateInterval)
+    {
+        return;
+    }
+    SunUpdateAccumulator = 0.0f;
+
+    // Skip render state updates until the sun has visibly changed
+    const FLinearColor Color = GetCurrentLightColor();
+    const float Intensity = GetCurrentLightIntensity();
+    const bool bRotationChanged = FMath::Abs(GetSunRotation() - LastSunPitch) >= SunRotationThreshold;
+    const bool bColorChanged = !Color.Equals(LastSunColor, SunLightThreshold);
+    const bool bIntensityChanged = FMath::Abs(Intensity - LastSunIntensity) > SunLightThreshold * FMath::Max(LastSunIntensity, 1.0f);
+
+    if (bRotationChanged || bColorChanged || bIntensityChanged)
+    {
+        UpdateSunLight();
+    }
+}
+
 void ATFDayNightCycle::UpdateSunLight()
 {
     if (!SunLight || !bControlSunLight)
@@ -316,17 +483,20 @@ void ATFDayNightCycle::UpdateSunLight()
     // Update rotation
     // Sun rises in the east, sets in the west
     // Pitch rotation: -90 at midnight (below horizon), 0 at sunrise, 90 at noon, 180 at sunset
-    const float SunPitch = GetSunRotation();
+    LastSunPitch = GetSunRotation();
     FRotator NewRotation = SunRotationAxis;
-    NewRotation.Pitch = SunPitch;
+    NewRotation.Pitch = LastSunPitch;
     SunLight->SetActorRotation(NewRotation);
 
     // Update light color
+    LastSunColor = GetCurrentLightColor();
+    LastSunIntensity = GetCurrentLightIntensity();
+
     ULightComponent* LightComponent = SunLight->GetLightComponent();
     if (LightComponent)
     {
-        LightComponent->SetLightColor(GetCurrentLightColor());
-        LightComponent->SetIntensity(GetCurrentLightIntensity());
+        LightComponent->SetLightColor(LastSunColor);
+        LightComponent->SetIntensity(LastSunIntensity);
     }
 }
 
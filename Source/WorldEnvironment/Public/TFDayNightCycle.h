@@ -9,6 +9,8 @@ class ADirectionalLight;
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnTimeChanged, float);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnDayChanged, int32);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnDayNightStateChanged, bool);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnDayPhaseChanged, int32);
+DECLARE_DELEGATE_OneParam(FOnScheduledTime, float);
 
 UCLASS()
 class WORLDENVIRONMENT_API ATFDayNightCycle : public AActor
@@ -54,6 +56,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Day Night Cycle|Settings")
     bool bCycleActive;
 
+    /** Game minutes between OnTimeChanged broadcasts */
+    UPROPERTY(EditAnywhere, Category = "Day Night Cycle|Settings", meta = (ClampMin = "0.01"))
+    float TimeChangedIntervalMinutes = 1.0f;
+
 #pragma endregion
 
 #pragma region Sun Light Settings
@@ -91,6 +97,18 @@ public:
     UPROPERTY(EditAnywhere, Category = "Day Night Cycle|Sun Light|Transition", meta = (ClampMin = "0.1", ClampMax = "6.0"))
     float DuskDurationHours = 1.5f;
 
+    /** Real seconds between sun light evaluations */
+    UPROPERTY(EditAnywhere, Category = "Day Night Cycle|Sun Light|Update", meta = (ClampMin = "0.0"))
+    float SunUpdateInterval = 0.1f;
+
+    /** Minimum pitch change, in degrees, before the sun is rotated again */
+    UPROPERTY(EditAnywhere, Category = "Day Night Cycle|Sun Light|Update", meta = (ClampMin = "0.0"))
+    float SunRotationThreshold = 0.1f;
+
+    /** Minimum color channel or relative intensity change before the light is updated again */
+    UPROPERTY(EditAnywhere, Category = "Day Night Cycle|Sun Light|Update", meta = (ClampMin = "0.0"))
+    float SunLightThreshold = 0.005f;
+
 #pragma endregion
 
 #pragma region Delegates
@@ -98,6 +116,19 @@ public:
     FOnTimeChanged OnTimeChanged;
     FOnDayChanged OnDayChanged;
     FOnDayNightStateChanged OnDayNightStateChanged;
+    FOnDayPhaseChanged OnDayPhaseChanged;
+
+#pragma endregion
+
+#pragma region Scheduler
+
+    /** Calls Callback with the current time every IntervalGameMinutes, aligned to multiples of the interval, and after every time jump */
+    FDelegateHandle ScheduleEvery(float IntervalGameMinutes, FOnScheduledTime Callback);
+
+    /** Calls Callback with the current time each day when the clock reaches Hour */
+    FDelegateHandle ScheduleAtHour(float Hour, FOnScheduledTime Callback);
+
+    void Unschedule(FDelegateHandle Handle);
 
 #pragma endregion
 
@@ -131,6 +162,67 @@ private:
     /** Tracks whether it was day in the previous tick for state change detection */
     bool bWasDay;
 
+    /** Day phase at the previous update, see GetDayPhase */
+    int32 LastDayPhase = 0;
+
+#pragma region Timeline
+
+    struct FScheduledEvent
+    {
+        /** Absolute game hours since day 1, 00:00 */
+        double DueTime;
+        double Period;
+        double Offset;
+        FDelegateHandle Handle;
+        FOnScheduledTime Callback;
+
+        /** Periodic listeners track the clock, so SetTime/AddHours/SetDay notify them at once */
+        bool bFireOnTimeJump = false;
+    };
+
+    struct FScheduledEventOrder
+    {
+        bool operator()(const FScheduledEvent& A, const FScheduledEvent& B) const { return A.DueTime < B.DueTime; }
+    };
+
+    /** Min-heap ordered by DueTime */
+    TArray<FScheduledEvent> Timeline;
+
+    FDelegateHandle DispatchingHandle;
+    bool bDispatchingUnscheduled = false;
+
+    FDelegateHandle TimeChangedHandle;
+
+    double GetAbsoluteTimeHours() const { return (CurrentDay - 1) * 24.0 + CurrentTimeHours; }
+    FDelegateHandle AddScheduledEvent(double Offset, double Period, FOnScheduledTime&& Callback, bool bFireOnTimeJump);
+    void DispatchTimeline();
+
+    /** Calls every listener scheduled with bFireOnTimeJump once with the new time */
+    void DispatchTimeJump();
+
+    /** Recompute every due time after the clock jumped */
+    void RebuildTimeline();
+
+    /** Re-sync listeners, timeline and sun after SetTime/AddHours/SetDay */
+    void HandleTimeJump();
+
+#pragma endregion
+
+#pragma region Sun Light Cache
+
+    float SunUpdateAccumulator = 0.0f;
+    float LastSunPitch = 0.0f;
+    FLinearColor LastSunColor = FLinearColor::Black;
+    float LastSunIntensity = 0.0f;
+
+#pragma endregion
+
+    /** Fire day/night and phase events if either changed */
+    void CheckDayStateChanges();
+
+    /** Update the sun at the configured cadence when it changed past the thresholds */
+    void TickSunLight(float DeltaTime);
+
     /** Update the time based on delta time */
     void UpdateTime(float DeltaTime);
 
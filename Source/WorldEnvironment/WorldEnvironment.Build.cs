@@ -17,6 +17,7 @@ public class WorldEnvironment : ModuleRules
 
         PrivateDependencyModuleNames.AddRange(new string[]
         {
+            "Interfaces"
         });
     }
 }